@@ -0,0 +1,87 @@
+#!/usr/bin/env python3
+"""
+Generates html_entities.h, the named character reference table used by html_to_json.c
+The names come from the WHATWG list (Python's html.entities.html5 is a copy of it)
+Run it again after a Python upgrade adds entities: python3 gen_entities.py > html_entities.h
+"""
+import html.entities
+
+FNV_OFFSET_BASIS = 0x811C9DC5
+FNV_PRIME = 0x01000193
+
+
+def entity_hash(seed, name):
+    # Same as entity_hash() in html_to_json.c: 32-bit FNV-1a, the seed replaces the offset basis
+    h = seed if seed else FNV_OFFSET_BASIS
+    for byte in name.encode():
+        h = ((h ^ byte) * FNV_PRIME) & 0xFFFFFFFF
+    return h
+
+
+def c_string(value):
+    # Every byte escaped, so a following character can't extend an escape
+    return '"' + ''.join('\\x%02x' % b for b in value.encode()) + '"'
+
+
+def main():
+    table = html.entities.html5
+
+    # "amp;" and "amp" are one entry, the second only says the semicolon may be left out
+    names = sorted(name[:-1] for name in table if name.endswith(';'))
+    legacy = {name for name in table if not name.endswith(';')}
+    size = len(names)
+
+    # Hash and displace: keys of a bucket are placed together with the first seed that puts them all in free slots,
+    # buckets holding a single key go straight into a free slot (stored as -slot - 1)
+    buckets = [[] for _ in range(size)]
+    for name in names:
+        buckets[entity_hash(0, name) % size].append(name)
+
+    displacements = [0] * size
+    slots = [None] * size
+    buckets.sort(key=len, reverse=True)
+
+    for bucket in buckets:
+        if len(bucket) <= 1:
+            break
+
+        seed = 1
+        while True:
+            placed = [entity_hash(seed, name) % size for name in bucket]
+            if len(set(placed)) == len(placed) and all(slots[slot] is None for slot in placed):
+                break
+            seed += 1
+
+        displacements[entity_hash(0, bucket[0]) % size] = seed
+        for name, slot in zip(bucket, placed):
+            slots[slot] = name
+
+    free = [slot for slot in range(size) if slots[slot] is None]
+    for bucket in buckets:
+        if len(bucket) != 1:
+            continue
+
+        slot = free.pop()
+        displacements[entity_hash(0, bucket[0]) % size] = -slot - 1
+        slots[slot] = bucket[0]
+
+    print('// Generated by gen_entities.py from the WHATWG named character references, do not edit')
+    print('// %d names, %d of them (legacy) also match without the semicolon' % (size, len(legacy)))
+    print()
+    print('#define NAMED_ENTITIES_LEN %d' % size)
+    print()
+    print('// Indexed by slot, see lookup_entity()')
+    print('Entity named_entities[NAMED_ENTITIES_LEN] = {')
+    for name in slots:
+        print('    { "%s", %s, %s },' % (name, c_string(table[name + ';']), 'true' if name in legacy else 'false'))
+    print('};')
+    print()
+    print('// Seed of each hash bucket, or -slot - 1 for buckets with a single name')
+    print('int named_entity_displacements[NAMED_ENTITIES_LEN] = {')
+    for i in range(0, size, 16):
+        print('    ' + ', '.join(str(d) for d in displacements[i:i + 16]) + ',')
+    print('};')
+
+
+if __name__ == '__main__':
+    main()
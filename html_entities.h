@@ -0,0 +1,2270 @@
+// Generated by gen_entities.py from the WHATWG named character references, do not edit
+// 2125 names, 106 of them (legacy) also match without the semicolon
+
+#define NAMED_ENTITIES_LEN 2125
+
+// Indexed by slot, see lookup_entity()
+Entity named_entities[NAMED_ENTITIES_LEN] = {
+    { "Tcedil", "\xc5\xa2", false },
+    { "updownarrow", "\xe2\x86\x95", false },
+    { "Fopf", "\xf0\x9d\x94\xbd", false },
+    { "curvearrowright", "\xe2\x86\xb7", false },
+    { "kjcy", "\xd1\x9c", false },
+    { "ufisht", "\xe2\xa5\xbe", false },
+    { "divonx", "\xe2\x8b\x87", false },
+    { "starf", "\xe2\x98\x85", false },
+    { "Otilde", "\xc3\x95", true },
+    { "eqcirc", "\xe2\x89\x96", false },
+    { "subdot", "\xe2\xaa\xbd", false },
+    { "gtrapprox", "\xe2\xaa\x86", false },
+    { "amp", "\x26", true },
+    { "doteqdot", "\xe2\x89\x91", false },
+    { "equest", "\xe2\x89\x9f", false },
+    { "racute", "\xc5\x95", false },
+    { "sqcup", "\xe2\x8a\x94", false },
+    { "edot", "\xc4\x97", false },
+    { "Sqrt", "\xe2\x88\x9a", false },
+    { "therefore", "\xe2\x88\xb4", false },
+    { "Tcaron", "\xc5\xa4", false },
+    { "supdsub", "\xe2\xab\x98", false },
+    { "multimap", "\xe2\x8a\xb8", false },
+    { "DownTeeArrow", "\xe2\x86\xa7", false },
+    { "coprod", "\xe2\x88\x90", false },
+    { "circledast", "\xe2\x8a\x9b", false },
+    { "lesdotor", "\xe2\xaa\x83", false },
+    { "bot", "\xe2\x8a\xa5", false },
+    { "leftrightharpoons", "\xe2\x87\x8b", false },
+    { "dotsquare", "\xe2\x8a\xa1", false },
+    { "complement", "\xe2\x88\x81", false },
+    { "oscr", "\xe2\x84\xb4", false },
+    { "Zopf", "\xe2\x84\xa4", false },
+    { "CircleTimes", "\xe2\x8a\x97", false },
+    { "vnsup", "\xe2\x8a\x83\xe2\x83\x92", false },
+    { "Gammad", "\xcf\x9c", false },
+    { "uparrow", "\xe2\x86\x91", false },
+    { "Sum", "\xe2\x88\x91", false },
+    { "Pi", "\xce\xa0", false },
+    { "LeftArrowBar", "\xe2\x87\xa4", false },
+    { "lbrack", "\x5b", false },
+    { "Igrave", "\xc3\x8c", true },
+    { "ll", "\xe2\x89\xaa", false },
+    { "rdquor", "\xe2\x80\x9d", false },
+    { "SucceedsSlantEqual", "\xe2\x89\xbd", false },
+    { "Beta", "\xce\x92", false },
+    { "uogon", "\xc5\xb3", false },
+    { "Ubrcy", "\xd0\x8e", false },
+    { "mapstoleft", "\xe2\x86\xa4", false },
+    { "gnap", "\xe2\xaa\x8a", false },
+    { "LeftDownVector", "\xe2\x87\x83", false },
+    { "boxhD", "\xe2\x95\xa5", false },
+    { "Bfr", "\xf0\x9d\x94\x85", false },
+    { "boxVL", "\xe2\x95\xa3", false },
+    { "Lscr", "\xe2\x84\x92", false },
+    { "rAarr", "\xe2\x87\x9b", false },
+    { "InvisibleComma", "\xe2\x81\xa3", false },
+    { "DiacriticalDot", "\xcb\x99", false },
+    { "cudarrl", "\xe2\xa4\xb8", false },
+    { "barvee", "\xe2\x8a\xbd", false },
+    { "hkswarow", "\xe2\xa4\xa6", false },
+    { "opar", "\xe2\xa6\xb7", false },
+    { "doteq", "\xe2\x89\x90", false },
+    { "uharr", "\xe2\x86\xbe", false },
+    { "circledR", "\xc2\xae", false },
+    { "ruluhar", "\xe2\xa5\xa8", false },
+    { "Square", "\xe2\x96\xa1", false },
+    { "ang", "\xe2\x88\xa0", false },
+    { "Updownarrow", "\xe2\x87\x95", false },
+    { "nsmid", "\xe2\x88\xa4", false },
+    { "Congruent", "\xe2\x89\xa1", false },
+    { "simeq", "\xe2\x89\x83", false },
+    { "sstarf", "\xe2\x8b\x86", false },
+    { "heartsuit", "\xe2\x99\xa5", false },
+    { "RightTee", "\xe2\x8a\xa2", false },
+    { "UnderBar", "\x5f", false },
+    { "RightTriangleEqual", "\xe2\x8a\xb5", false },
+    { "MediumSpace", "\xe2\x81\x9f", false },
+    { "prnsim", "\xe2\x8b\xa8", false },
+    { "int", "\xe2\x88\xab", false },
+    { "CloseCurlyQuote", "\xe2\x80\x99", false },
+    { "prec", "\xe2\x89\xba", false },
+    { "cwconint", "\xe2\x88\xb2", false },
+    { "rBarr", "\xe2\xa4\x8f", false },
+    { "lnap", "\xe2\xaa\x89", false },
+    { "nldr", "\xe2\x80\xa5", false },
+    { "varsupsetneqq", "\xe2\xab\x8c\xef\xb8\x80", false },
+    { "nharr", "\xe2\x86\xae", false },
+    { "elsdot", "\xe2\xaa\x97", false },
+    { "alpha", "\xce\xb1", false },
+    { "Nopf", "\xe2\x84\x95", false },
+    { "searrow", "\xe2\x86\x98", false },
+    { "ne", "\xe2\x89\xa0", false },
+    { "Ofr", "\xf0\x9d\x94\x92", false },
+    { "gap", "\xe2\xaa\x86", false },
+    { "NotRightTriangle", "\xe2\x8b\xab", false },
+    { "djcy", "\xd1\x92", false },
+    { "circledS", "\xe2\x93\x88", false },
+    { "yscr", "\xf0\x9d\x93\x8e", false },
+    { "bemptyv", "\xe2\xa6\xb0", false },
+    { "uuml", "\xc3\xbc", true },
+    { "escr", "\xe2\x84\xaf", false },
+    { "bsolhsub", "\xe2\x9f\x88", false },
+    { "aogon", "\xc4\x85", false },
+    { "because", "\xe2\x88\xb5", false },
+    { "NotReverseElement", "\xe2\x88\x8c", false },
+    { "zscr", "\xf0\x9d\x93\x8f", false },
+    { "lparlt", "\xe2\xa6\x93", false },
+    { "napE", "\xe2\xa9\xb0\xcc\xb8", false },
+    { "nsupseteq", "\xe2\x8a\x89", false },
+    { "backsim", "\xe2\x88\xbd", false },
+    { "frac13", "\xe2\x85\x93", false },
+    { "Verbar", "\xe2\x80\x96", false },
+    { "Fouriertrf", "\xe2\x84\xb1", false },
+    { "Vert", "\xe2\x80\x96", false },
+    { "homtht", "\xe2\x88\xbb", false },
+    { "Barwed", "\xe2\x8c\x86", false },
+    { "Rarr", "\xe2\x86\xa0", false },
+    { "varsupsetneq", "\xe2\x8a\x8b\xef\xb8\x80", false },
+    { "longleftarrow", "\xe2\x9f\xb5", false },
+    { "NotTildeEqual", "\xe2\x89\x84", false },
+    { "pfr", "\xf0\x9d\x94\xad", false },
+    { "NotGreaterFullEqual", "\xe2\x89\xa7\xcc\xb8", false },
+    { "Qopf", "\xe2\x84\x9a", false },
+    { "ccedil", "\xc3\xa7", true },
+    { "mopf", "\xf0\x9d\x95\x9e", false },
+    { "angmsdab", "\xe2\xa6\xa9", false },
+    { "Mopf", "\xf0\x9d\x95\x84", false },
+    { "ogon", "\xcb\x9b", false },
+    { "Zcaron", "\xc5\xbd", false },
+    { "epsiv", "\xcf\xb5", false },
+    { "leqq", "\xe2\x89\xa6", false },
+    { "nang", "\xe2\x88\xa0\xe2\x83\x92", false },
+    { "lfisht", "\xe2\xa5\xbc", false },
+    { "Ncy", "\xd0\x9d", false },
+    { "chcy", "\xd1\x87", false },
+    { "Product", "\xe2\x88\x8f", false },
+    { "swarrow", "\xe2\x86\x99", false },
+    { "cwint", "\xe2\x88\xb1", false },
+    { "cupcap", "\xe2\xa9\x86", false },
+    { "ltrPar", "\xe2\xa6\x96", false },
+    { "lates", "\xe2\xaa\xad\xef\xb8\x80", false },
+    { "Sscr", "\xf0\x9d\x92\xae", false },
+    { "CupCap", "\xe2\x89\x8d", false },
+    { "varpi", "\xcf\x96", false },
+    { "square", "\xe2\x96\xa1", false },
+    { "lrhar", "\xe2\x87\x8b", false },
+    { "RightAngleBracket", "\xe2\x9f\xa9", false },
+    { "lesseqqgtr", "\xe2\xaa\x8b", false },
+    { "intlarhk", "\xe2\xa8\x97", false },
+    { "gg", "\xe2\x89\xab", false },
+    { "Odblac", "\xc5\x90", false },
+    { "lsqb", "\x5b", false },
+    { "reg", "\xc2\xae", true },
+    { "ovbar", "\xe2\x8c\xbd", false },
+    { "bbrk", "\xe2\x8e\xb5", false },
+    { "eqvparsl", "\xe2\xa7\xa5", false },
+    { "Gt", "\xe2\x89\xab", false },
+    { "Imacr", "\xc4\xaa", false },
+    { "boxDL", "\xe2\x95\x97", false },
+    { "Ouml", "\xc3\x96", true },
+    { "IOcy", "\xd0\x81", false },
+    { "lowbar", "\x5f", false },
+    { "ccups", "\xe2\xa9\x8c", false },
+    { "geq", "\xe2\x89\xa5", false },
+    { "boxvH", "\xe2\x95\xaa", false },
+    { "radic", "\xe2\x88\x9a", false },
+    { "boxtimes", "\xe2\x8a\xa0", false },
+    { "Emacr", "\xc4\x92", false },
+    { "ucy", "\xd1\x83", false },
+    { "notinE", "\xe2\x8b\xb9\xcc\xb8", false },
+    { "ntlg", "\xe2\x89\xb8", false },
+    { "cuvee", "\xe2\x8b\x8e", false },
+    { "nLt", "\xe2\x89\xaa\xe2\x83\x92", false },
+    { "nbump", "\xe2\x89\x8e\xcc\xb8", false },
+    { "Element", "\xe2\x88\x88", false },
+    { "ncongdot", "\xe2\xa9\xad\xcc\xb8", false },
+    { "xrarr", "\xe2\x9f\xb6", false },
+    { "Wscr", "\xf0\x9d\x92\xb2", false },
+    { "leftharpoondown", "\xe2\x86\xbd", false },
+    { "cudarrr", "\xe2\xa4\xb5", false },
+    { "nopf", "\xf0\x9d\x95\x9f", false },
+    { "tprime", "\xe2\x80\xb4", false },
+    { "LeftVectorBar", "\xe2\xa5\x92", false },
+    { "iiint", "\xe2\x88\xad", false },
+    { "TScy", "\xd0\xa6", false },
+    { "boxDl", "\xe2\x95\x96", false },
+    { "orarr", "\xe2\x86\xbb", false },
+    { "napprox", "\xe2\x89\x89", false },
+    { "plus", "\x2b", false },
+    { "Omicron", "\xce\x9f", false },
+    { "downarrow", "\xe2\x86\x93", false },
+    { "notnivc", "\xe2\x8b\xbd", false },
+    { "seswar", "\xe2\xa4\xa9", false },
+    { "LeftTriangle", "\xe2\x8a\xb2", false },
+    { "Lacute", "\xc4\xb9", false },
+    { "dHar", "\xe2\xa5\xa5", false },
+    { "npar", "\xe2\x88\xa6", false },
+    { "scaron", "\xc5\xa1", false },
+    { "nshortparallel", "\xe2\x88\xa6", false },
+    { "lnapprox", "\xe2\xaa\x89", false },
+    { "LeftTee", "\xe2\x8a\xa3", false },
+    { "rcaron", "\xc5\x99", false },
+    { "imath", "\xc4\xb1", false },
+    { "curarrm", "\xe2\xa4\xbc", false },
+    { "angmsdag", "\xe2\xa6\xae", false },
+    { "Ecirc", "\xc3\x8a", true },
+    { "compfn", "\xe2\x88\x98", false },
+    { "mu", "\xce\xbc", false },
+    { "sung", "\xe2\x99\xaa", false },
+    { "npr", "\xe2\x8a\x80", false },
+    { "imof", "\xe2\x8a\xb7", false },
+    { "lsquo", "\xe2\x80\x98", false },
+    { "Uparrow", "\xe2\x87\x91", false },
+    { "bigtriangledown", "\xe2\x96\xbd", false },
+    { "GreaterLess", "\xe2\x89\xb7", false },
+    { "slarr", "\xe2\x86\x90", false },
+    { "aacute", "\xc3\xa1", true },
+    { "OpenCurlyQuote", "\xe2\x80\x98", false },
+    { "midcir", "\xe2\xab\xb0", false },
+    { "copf", "\xf0\x9d\x95\x94", false },
+    { "lharul", "\xe2\xa5\xaa", false },
+    { "boxVH", "\xe2\x95\xac", false },
+    { "pre", "\xe2\xaa\xaf", false },
+    { "rbrksld", "\xe2\xa6\x8e", false },
+    { "uHar", "\xe2\xa5\xa3", false },
+    { "gla", "\xe2\xaa\xa5", false },
+    { "Yuml", "\xc5\xb8", false },
+    { "mscr", "\xf0\x9d\x93\x82", false },
+    { "phiv", "\xcf\x95", false },
+    { "ubreve", "\xc5\xad", false },
+    { "yacute", "\xc3\xbd", true },
+    { "dotminus", "\xe2\x88\xb8", false },
+    { "bigvee", "\xe2\x8b\x81", false },
+    { "succ", "\xe2\x89\xbb", false },
+    { "jscr", "\xf0\x9d\x92\xbf", false },
+    { "QUOT", "\x22", true },
+    { "LowerRightArrow", "\xe2\x86\x98", false },
+    { "VeryThinSpace", "\xe2\x80\x8a", false },
+    { "rtri", "\xe2\x96\xb9", false },
+    { "bullet", "\xe2\x80\xa2", false },
+    { "pcy", "\xd0\xbf", false },
+    { "Scy", "\xd0\xa1", false },
+    { "NotLeftTriangleBar", "\xe2\xa7\x8f\xcc\xb8", false },
+    { "Uogon", "\xc5\xb2", false },
+    { "map", "\xe2\x86\xa6", false },
+    { "UpTeeArrow", "\xe2\x86\xa5", false },
+    { "pm", "\xc2\xb1", false },
+    { "RightTeeArrow", "\xe2\x86\xa6", false },
+    { "hksearow", "\xe2\xa4\xa5", false },
+    { "UnderBracket", "\xe2\x8e\xb5", false },
+    { "xoplus", "\xe2\xa8\x81", false },
+    { "ExponentialE", "\xe2\x85\x87", false },
+    { "gopf", "\xf0\x9d\x95\x98", false },
+    { "PlusMinus", "\xc2\xb1", false },
+    { "VerticalBar", "\xe2\x88\xa3", false },
+    { "uwangle", "\xe2\xa6\xa7", false },
+    { "lesseqgtr", "\xe2\x8b\x9a", false },
+    { "bump", "\xe2\x89\x8e", false },
+    { "nrtri", "\xe2\x8b\xab", false },
+    { "nhpar", "\xe2\xab\xb2", false },
+    { "latail", "\xe2\xa4\x99", false },
+    { "ntilde", "\xc3\xb1", true },
+    { "uArr", "\xe2\x87\x91", false },
+    { "Pcy", "\xd0\x9f", false },
+    { "Pr", "\xe2\xaa\xbb", false },
+    { "NotLessEqual", "\xe2\x89\xb0", false },
+    { "Ffr", "\xf0\x9d\x94\x89", false },
+    { "ecir", "\xe2\x89\x96", false },
+    { "Aacute", "\xc3\x81", true },
+    { "DoubleVerticalBar", "\xe2\x88\xa5", false },
+    { "varsubsetneqq", "\xe2\xab\x8b\xef\xb8\x80", false },
+    { "ReverseElement", "\xe2\x88\x8b", false },
+    { "searhk", "\xe2\xa4\xa5", false },
+    { "NotVerticalBar", "\xe2\x88\xa4", false },
+    { "Kfr", "\xf0\x9d\x94\x8e", false },
+    { "smte", "\xe2\xaa\xac", false },
+    { "mapstoup", "\xe2\x86\xa5", false },
+    { "dfisht", "\xe2\xa5\xbf", false },
+    { "prnE", "\xe2\xaa\xb5", false },
+    { "ntrianglelefteq", "\xe2\x8b\xac", false },
+    { "straightepsilon", "\xcf\xb5", false },
+    { "NegativeMediumSpace", "\xe2\x80\x8b", false },
+    { "ltcir", "\xe2\xa9\xb9", false },
+    { "Escr", "\xe2\x84\xb0", false },
+    { "Zdot", "\xc5\xbb", false },
+    { "lesg", "\xe2\x8b\x9a\xef\xb8\x80", false },
+    { "lAarr", "\xe2\x87\x9a", false },
+    { "ddarr", "\xe2\x87\x8a", false },
+    { "jcy", "\xd0\xb9", false },
+    { "Oslash", "\xc3\x98", true },
+    { "acE", "\xe2\x88\xbe\xcc\xb3", false },
+    { "NegativeVeryThinSpace", "\xe2\x80\x8b", false },
+    { "subrarr", "\xe2\xa5\xb9", false },
+    { "RightDownVectorBar", "\xe2\xa5\x95", false },
+    { "supsub", "\xe2\xab\x94", false },
+    { "smid", "\xe2\x88\xa3", false },
+    { "gjcy", "\xd1\x93", false },
+    { "Subset", "\xe2\x8b\x90", false },
+    { "bigoplus", "\xe2\xa8\x81", false },
+    { "ap", "\xe2\x89\x88", false },
+    { "rightleftharpoons", "\xe2\x87\x8c", false },
+    { "scy", "\xd1\x81", false },
+    { "oast", "\xe2\x8a\x9b", false },
+    { "Bumpeq", "\xe2\x89\x8e", false },
+    { "NotElement", "\xe2\x88\x89", false },
+    { "eparsl", "\xe2\xa7\xa3", false },
+    { "cdot", "\xc4\x8b", false },
+    { "ohbar", "\xe2\xa6\xb5", false },
+    { "piv", "\xcf\x96", false },
+    { "nsupseteqq", "\xe2\xab\x86\xcc\xb8", false },
+    { "Implies", "\xe2\x87\x92", false },
+    { "cap", "\xe2\x88\xa9", false },
+    { "ShortRightArrow", "\xe2\x86\x92", false },
+    { "Intersection", "\xe2\x8b\x82", false },
+    { "zcaron", "\xc5\xbe", false },
+    { "copysr", "\xe2\x84\x97", false },
+    { "itilde", "\xc4\xa9", false },
+    { "rbrke", "\xe2\xa6\x8c", false },
+    { "lfr", "\xf0\x9d\x94\xa9", false },
+    { "OpenCurlyDoubleQuote", "\xe2\x80\x9c", false },
+    { "xutri", "\xe2\x96\xb3", false },
+    { "aleph", "\xe2\x84\xb5", false },
+    { "equals", "\x3d", false },
+    { "xscr", "\xf0\x9d\x93\x8d", false },
+    { "RightTriangleBar", "\xe2\xa7\x90", false },
+    { "kfr", "\xf0\x9d\x94\xa8", false },
+    { "larrhk", "\xe2\x86\xa9", false },
+    { "ulcorn", "\xe2\x8c\x9c", false },
+    { "nsime", "\xe2\x89\x84", false },
+    { "DoubleLeftRightArrow", "\xe2\x87\x94", false },
+    { "zcy", "\xd0\xb7", false },
+    { "Kopf", "\xf0\x9d\x95\x82", false },
+    { "nbsp", "\xc2\xa0", true },
+    { "lmidot", "\xc5\x80", false },
+    { "Vdashl", "\xe2\xab\xa6", false },
+    { "odsold", "\xe2\xa6\xbc", false },
+    { "blacklozenge", "\xe2\xa7\xab", false },
+    { "lat", "\xe2\xaa\xab", false },
+    { "wedge", "\xe2\x88\xa7", false },
+    { "boxuR", "\xe2\x95\x98", false },
+    { "phi", "\xcf\x86", false },
+    { "times", "\xc3\x97", true },
+    { "precneqq", "\xe2\xaa\xb5", false },
+    { "prop", "\xe2\x88\x9d", false },
+    { "rlarr", "\xe2\x87\x84", false },
+    { "tscy", "\xd1\x86", false },
+    { "lessdot", "\xe2\x8b\x96", false },
+    { "semi", "\x3b", false },
+    { "imagline", "\xe2\x84\x90", false },
+    { "HumpEqual", "\xe2\x89\x8f", false },
+    { "Lsh", "\xe2\x86\xb0", false },
+    { "bigodot", "\xe2\xa8\x80", false },
+    { "ClockwiseContourIntegral", "\xe2\x88\xb2", false },
+    { "Lfr", "\xf0\x9d\x94\x8f", false },
+    { "prE", "\xe2\xaa\xb3", false },
+    { "NegativeThickSpace", "\xe2\x80\x8b", false },
+    { "rbarr", "\xe2\xa4\x8d", false },
+    { "Rho", "\xce\xa1", false },
+    { "nsc", "\xe2\x8a\x81", false },
+    { "nexist", "\xe2\x88\x84", false },
+    { "Barv", "\xe2\xab\xa7", false },
+    { "bumpe", "\xe2\x89\x8f", false },
+    { "uharl", "\xe2\x86\xbf", false },
+    { "Vfr", "\xf0\x9d\x94\x99", false },
+    { "frasl", "\xe2\x81\x84", false },
+    { "jopf", "\xf0\x9d\x95\x9b", false },
+    { "supdot", "\xe2\xaa\xbe", false },
+    { "dtrif", "\xe2\x96\xbe", false },
+    { "NotEqualTilde", "\xe2\x89\x82\xcc\xb8", false },
+    { "otilde", "\xc3\xb5", true },
+    { "Dcy", "\xd0\x94", false },
+    { "Pscr", "\xf0\x9d\x92\xab", false },
+    { "NotDoubleVerticalBar", "\xe2\x88\xa6", false },
+    { "rscr", "\xf0\x9d\x93\x87", false },
+    { "blacktriangledown", "\xe2\x96\xbe", false },
+    { "NotTildeFullEqual", "\xe2\x89\x87", false },
+    { "looparrowright", "\xe2\x86\xac", false },
+    { "NonBreakingSpace", "\xc2\xa0", false },
+    { "bowtie", "\xe2\x8b\x88", false },
+    { "rightleftarrows", "\xe2\x87\x84", false },
+    { "orslope", "\xe2\xa9\x97", false },
+    { "jukcy", "\xd1\x94", false },
+    { "jfr", "\xf0\x9d\x94\xa7", false },
+    { "epar", "\xe2\x8b\x95", false },
+    { "SquareSubsetEqual", "\xe2\x8a\x91", false },
+    { "notnivb", "\xe2\x8b\xbe", false },
+    { "ntrianglerighteq", "\xe2\x8b\xad", false },
+    { "gesdoto", "\xe2\xaa\x82", false },
+    { "rightharpoonup", "\xe2\x87\x80", false },
+    { "sharp", "\xe2\x99\xaf", false },
+    { "RightUpDownVector", "\xe2\xa5\x8f", false },
+    { "gnE", "\xe2\x89\xa9", false },
+    { "angmsdad", "\xe2\xa6\xab", false },
+    { "ContourIntegral", "\xe2\x88\xae", false },
+    { "ccirc", "\xc4\x89", false },
+    { "rightthreetimes", "\xe2\x8b\x8c", false },
+    { "lang", "\xe2\x9f\xa8", false },
+    { "quot", "\x22", true },
+    { "lopf", "\xf0\x9d\x95\x9d", false },
+    { "TRADE", "\xe2\x84\xa2", false },
+    { "caron", "\xcb\x87", false },
+    { "notinvc", "\xe2\x8b\xb6", false },
+    { "LT", "\x3c", true },
+    { "OElig", "\xc5\x92", false },
+    { "varphi", "\xcf\x95", false },
+    { "Conint", "\xe2\x88\xaf", false },
+    { "isin", "\xe2\x88\x88", false },
+    { "sext", "\xe2\x9c\xb6", false },
+    { "gnapprox", "\xe2\xaa\x8a", false },
+    { "barwedge", "\xe2\x8c\x85", false },
+    { "thetav", "\xcf\x91", false },
+    { "mapstodown", "\xe2\x86\xa7", false },
+    { "top", "\xe2\x8a\xa4", false },
+    { "rarrpl", "\xe2\xa5\x85", false },
+    { "Scirc", "\xc5\x9c", false },
+    { "triangleright", "\xe2\x96\xb9", false },
+    { "utri", "\xe2\x96\xb5", false },
+    { "Xi", "\xce\x9e", false },
+    { "Hcirc", "\xc4\xa4", false },
+    { "nlarr", "\xe2\x86\x9a", false },
+    { "spadesuit", "\xe2\x99\xa0", false },
+    { "lbbrk", "\xe2\x9d\xb2", false },
+    { "ohm", "\xce\xa9", false },
+    { "iuml", "\xc3\xaf", true },
+    { "acd", "\xe2\x88\xbf", false },
+    { "PartialD", "\xe2\x88\x82", false },
+    { "Precedes", "\xe2\x89\xba", false },
+    { "dwangle", "\xe2\xa6\xa6", false },
+    { "eogon", "\xc4\x99", false },
+    { "ndash", "\xe2\x80\x93", false },
+    { "andd", "\xe2\xa9\x9c", false },
+    { "Dagger", "\xe2\x80\xa1", false },
+    { "hamilt", "\xe2\x84\x8b", false },
+    { "rharul", "\xe2\xa5\xac", false },
+    { "NotGreaterGreater", "\xe2\x89\xab\xcc\xb8", false },
+    { "Yfr", "\xf0\x9d\x94\x9c", false },
+    { "Eta", "\xce\x97", false },
+    { "vBar", "\xe2\xab\xa8", false },
+    { "blacktriangle", "\xe2\x96\xb4", false },
+    { "supsim", "\xe2\xab\x88", false },
+    { "Jscr", "\xf0\x9d\x92\xa5", false },
+    { "gesdotol", "\xe2\xaa\x84", false },
+    { "mumap", "\xe2\x8a\xb8", false },
+    { "iquest", "\xc2\xbf", true },
+    { "NotSuperset", "\xe2\x8a\x83\xe2\x83\x92", false },
+    { "lesdot", "\xe2\xa9\xbf", false },
+    { "ge", "\xe2\x89\xa5", false },
+    { "star", "\xe2\x98\x86", false },
+    { "sqsubset", "\xe2\x8a\x8f", false },
+    { "rthree", "\xe2\x8b\x8c", false },
+    { "SquareIntersection", "\xe2\x8a\x93", false },
+    { "lg", "\xe2\x89\xb6", false },
+    { "ii", "\xe2\x85\x88", false },
+    { "SquareSuperset", "\xe2\x8a\x90", false },
+    { "asymp", "\xe2\x89\x88", false },
+    { "RightTeeVector", "\xe2\xa5\x9b", false },
+    { "LongRightArrow", "\xe2\x9f\xb6", false },
+    { "downharpoonleft", "\xe2\x87\x83", false },
+    { "leftharpoonup", "\xe2\x86\xbc", false },
+    { "boxDr", "\xe2\x95\x93", false },
+    { "bigcap", "\xe2\x8b\x82", false },
+    { "Scaron", "\xc5\xa0", false },
+    { "omacr", "\xc5\x8d", false },
+    { "longrightarrow", "\xe2\x9f\xb6", false },
+    { "NotHumpDownHump", "\xe2\x89\x8e\xcc\xb8", false },
+    { "isinv", "\xe2\x88\x88", false },
+    { "equivDD", "\xe2\xa9\xb8", false },
+    { "supsetneqq", "\xe2\xab\x8c", false },
+    { "Wcirc", "\xc5\xb4", false },
+    { "af", "\xe2\x81\xa1", false },
+    { "gtreqless", "\xe2\x8b\x9b", false },
+    { "NestedLessLess", "\xe2\x89\xaa", false },
+    { "bigtriangleup", "\xe2\x96\xb3", false },
+    { "diamondsuit", "\xe2\x99\xa6", false },
+    { "subsetneq", "\xe2\x8a\x8a", false },
+    { "bnequiv", "\xe2\x89\xa1\xe2\x83\xa5", false },
+    { "it", "\xe2\x81\xa2", false },
+    { "rotimes", "\xe2\xa8\xb5", false },
+    { "Omacr", "\xc5\x8c", false },
+    { "searr", "\xe2\x86\x98", false },
+    { "Scedil", "\xc5\x9e", false },
+    { "frac38", "\xe2\x85\x9c", false },
+    { "wreath", "\xe2\x89\x80", false },
+    { "lbrkslu", "\xe2\xa6\x8d", false },
+    { "rbrack", "\x5d", false },
+    { "DownRightTeeVector", "\xe2\xa5\x9f", false },
+    { "rpargt", "\xe2\xa6\x94", false },
+    { "frac25", "\xe2\x85\x96", false },
+    { "dfr", "\xf0\x9d\x94\xa1", false },
+    { "ifr", "\xf0\x9d\x94\xa6", false },
+    { "nwnear", "\xe2\xa4\xa7", false },
+    { "preccurlyeq", "\xe2\x89\xbc", false },
+    { "notniva", "\xe2\x88\x8c", false },
+    { "tcedil", "\xc5\xa3", false },
+    { "angzarr", "\xe2\x8d\xbc", false },
+    { "hopf", "\xf0\x9d\x95\x99", false },
+    { "Therefore", "\xe2\x88\xb4", false },
+    { "lrarr", "\xe2\x87\x86", false },
+    { "pluscir", "\xe2\xa8\xa2", false },
+    { "zfr", "\xf0\x9d\x94\xb7", false },
+    { "Ll", "\xe2\x8b\x98", false },
+    { "sqsup", "\xe2\x8a\x90", false },
+    { "Cconint", "\xe2\x88\xb0", false },
+    { "swArr", "\xe2\x87\x99", false },
+    { "DownArrowUpArrow", "\xe2\x87\xb5", false },
+    { "wr", "\xe2\x89\x80", false },
+    { "npolint", "\xe2\xa8\x94", false },
+    { "lesges", "\xe2\xaa\x93", false },
+    { "dzcy", "\xd1\x9f", false },
+    { "urcrop", "\xe2\x8c\x8e", false },
+    { "digamma", "\xcf\x9d", false },
+    { "approx", "\xe2\x89\x88", false },
+    { "nearr", "\xe2\x86\x97", false },
+    { "LeftVector", "\xe2\x86\xbc", false },
+    { "Kcedil", "\xc4\xb6", false },
+    { "varepsilon", "\xcf\xb5", false },
+    { "cups", "\xe2\x88\xaa\xef\xb8\x80", false },
+    { "prcue", "\xe2\x89\xbc", false },
+    { "sc", "\xe2\x89\xbb", false },
+    { "Gg", "\xe2\x8b\x99", false },
+    { "gammad", "\xcf\x9d", false },
+    { "ncedil", "\xc5\x86", false },
+    { "rarrb", "\xe2\x87\xa5", false },
+    { "bull", "\xe2\x80\xa2", false },
+    { "rang", "\xe2\x9f\xa9", false },
+    { "plusacir", "\xe2\xa8\xa3", false },
+    { "vfr", "\xf0\x9d\x94\xb3", false },
+    { "Ufr", "\xf0\x9d\x94\x98", false },
+    { "ocy", "\xd0\xbe", false },
+    { "NotSucceedsEqual", "\xe2\xaa\xb0\xcc\xb8", false },
+    { "trianglelefteq", "\xe2\x8a\xb4", false },
+    { "upuparrows", "\xe2\x87\x88", false },
+    { "Not", "\xe2\xab\xac", false },
+    { "omid", "\xe2\xa6\xb6", false },
+    { "nltri", "\xe2\x8b\xaa", false },
+    { "oacute", "\xc3\xb3", true },
+    { "gneqq", "\xe2\x89\xa9", false },
+    { "ecirc", "\xc3\xaa", true },
+    { "Ifr", "\xe2\x84\x91", false },
+    { "glj", "\xe2\xaa\xa4", false },
+    { "lBarr", "\xe2\xa4\x8e", false },
+    { "bigcup", "\xe2\x8b\x83", false },
+    { "asympeq", "\xe2\x89\x8d", false },
+    { "NotSquareSupersetEqual", "\xe2\x8b\xa3", false },
+    { "nGtv", "\xe2\x89\xab\xcc\xb8", false },
+    { "NotNestedLessLess", "\xe2\xaa\xa1\xcc\xb8", false },
+    { "rpar", "\x29", false },
+    { "sscr", "\xf0\x9d\x93\x88", false },
+    { "NotPrecedes", "\xe2\x8a\x80", false },
+    { "UpEquilibrium", "\xe2\xa5\xae", false },
+    { "dash", "\xe2\x80\x90", false },
+    { "smtes", "\xe2\xaa\xac\xef\xb8\x80", false },
+    { "ange", "\xe2\xa6\xa4", false },
+    { "sub", "\xe2\x8a\x82", false },
+    { "ForAll", "\xe2\x88\x80", false },
+    { "macr", "\xc2\xaf", true },
+    { "lstrok", "\xc5\x82", false },
+    { "uplus", "\xe2\x8a\x8e", false },
+    { "Diamond", "\xe2\x8b\x84", false },
+    { "lnE", "\xe2\x89\xa8", false },
+    { "Mu", "\xce\x9c", false },
+    { "range", "\xe2\xa6\xa5", false },
+    { "LeftUpVector", "\xe2\x86\xbf", false },
+    { "nrtrie", "\xe2\x8b\xad", false },
+    { "cong", "\xe2\x89\x85", false },
+    { "NotTilde", "\xe2\x89\x81", false },
+    { "Omega", "\xce\xa9", false },
+    { "Larr", "\xe2\x86\x9e", false },
+    { "DownRightVectorBar", "\xe2\xa5\x97", false },
+    { "Tstrok", "\xc5\xa6", false },
+    { "udarr", "\xe2\x87\x85", false },
+    { "Zfr", "\xe2\x84\xa8", false },
+    { "sqsubseteq", "\xe2\x8a\x91", false },
+    { "jsercy", "\xd1\x98", false },
+    { "cuwed", "\xe2\x8b\x8f", false },
+    { "frac14", "\xc2\xbc", true },
+    { "niv", "\xe2\x88\x8b", false },
+    { "rnmid", "\xe2\xab\xae", false },
+    { "oline", "\xe2\x80\xbe", false },
+    { "intprod", "\xe2\xa8\xbc", false },
+    { "sup2", "\xc2\xb2", true },
+    { "jcirc", "\xc4\xb5", false },
+    { "NotGreaterTilde", "\xe2\x89\xb5", false },
+    { "ngt", "\xe2\x89\xaf", false },
+    { "integers", "\xe2\x84\xa4", false },
+    { "backprime", "\xe2\x80\xb5", false },
+    { "Sfr", "\xf0\x9d\x94\x96", false },
+    { "rtimes", "\xe2\x8b\x8a", false },
+    { "uring", "\xc5\xaf", false },
+    { "ordm", "\xc2\xba", true },
+    { "lesdoto", "\xe2\xaa\x81", false },
+    { "bcy", "\xd0\xb1", false },
+    { "lsaquo", "\xe2\x80\xb9", false },
+    { "lrtri", "\xe2\x8a\xbf", false },
+    { "Ncaron", "\xc5\x87", false },
+    { "DDotrahd", "\xe2\xa4\x91", false },
+    { "plusb", "\xe2\x8a\x9e", false },
+    { "cedil", "\xc2\xb8", true },
+    { "thetasym", "\xcf\x91", false },
+    { "geqslant", "\xe2\xa9\xbe", false },
+    { "laemptyv", "\xe2\xa6\xb4", false },
+    { "simrarr", "\xe2\xa5\xb2", false },
+    { "iiiint", "\xe2\xa8\x8c", false },
+    { "Uacute", "\xc3\x9a", true },
+    { "realine", "\xe2\x84\x9b", false },
+    { "breve", "\xcb\x98", false },
+    { "rdsh", "\xe2\x86\xb3", false },
+    { "CircleDot", "\xe2\x8a\x99", false },
+    { "colon", "\x3a", false },
+    { "Nscr", "\xf0\x9d\x92\xa9", false },
+    { "ogt", "\xe2\xa7\x81", false },
+    { "lescc", "\xe2\xaa\xa8", false },
+    { "Wedge", "\xe2\x8b\x80", false },
+    { "Aopf", "\xf0\x9d\x94\xb8", false },
+    { "zopf", "\xf0\x9d\x95\xab", false },
+    { "drcrop", "\xe2\x8c\x8c", false },
+    { "SubsetEqual", "\xe2\x8a\x86", false },
+    { "bscr", "\xf0\x9d\x92\xb7", false },
+    { "atilde", "\xc3\xa3", true },
+    { "osol", "\xe2\x8a\x98", false },
+    { "lbrksld", "\xe2\xa6\x8f", false },
+    { "lcaron", "\xc4\xbe", false },
+    { "NotGreaterEqual", "\xe2\x89\xb1", false },
+    { "ccaron", "\xc4\x8d", false },
+    { "Kcy", "\xd0\x9a", false },
+    { "ocir", "\xe2\x8a\x9a", false },
+    { "CapitalDifferentialD", "\xe2\x85\x85", false },
+    { "NotSubset", "\xe2\x8a\x82\xe2\x83\x92", false },
+    { "dopf", "\xf0\x9d\x95\x95", false },
+    { "circeq", "\xe2\x89\x97", false },
+    { "Jcirc", "\xc4\xb4", false },
+    { "AElig", "\xc3\x86", true },
+    { "DoubleRightArrow", "\xe2\x87\x92", false },
+    { "yfr", "\xf0\x9d\x94\xb6", false },
+    { "circledcirc", "\xe2\x8a\x9a", false },
+    { "Chi", "\xce\xa7", false },
+    { "ldquo", "\xe2\x80\x9c", false },
+    { "LessGreater", "\xe2\x89\xb6", false },
+    { "lscr", "\xf0\x9d\x93\x81", false },
+    { "excl", "\x21", false },
+    { "cirmid", "\xe2\xab\xaf", false },
+    { "lozenge", "\xe2\x97\x8a", false },
+    { "Sigma", "\xce\xa3", false },
+    { "ldquor", "\xe2\x80\x9e", false },
+    { "ntriangleright", "\xe2\x8b\xab", false },
+    { "lneq", "\xe2\xaa\x87", false },
+    { "fltns", "\xe2\x96\xb1", false },
+    { "llhard", "\xe2\xa5\xab", false },
+    { "UpTee", "\xe2\x8a\xa5", false },
+    { "trade", "\xe2\x84\xa2", false },
+    { "sqcaps", "\xe2\x8a\x93\xef\xb8\x80", false },
+    { "RoundImplies", "\xe2\xa5\xb0", false },
+    { "ges", "\xe2\xa9\xbe", false },
+    { "blacksquare", "\xe2\x96\xaa", false },
+    { "nLl", "\xe2\x8b\x98\xcc\xb8", false },
+    { "ape", "\xe2\x89\x8a", false },
+    { "shortmid", "\xe2\x88\xa3", false },
+    { "sdot", "\xe2\x8b\x85", false },
+    { "subnE", "\xe2\xab\x8b", false },
+    { "NotSubsetEqual", "\xe2\x8a\x88", false },
+    { "supe", "\xe2\x8a\x87", false },
+    { "nsubseteqq", "\xe2\xab\x85\xcc\xb8", false },
+    { "Cedilla", "\xc2\xb8", false },
+    { "andv", "\xe2\xa9\x9a", false },
+    { "imacr", "\xc4\xab", false },
+    { "Dfr", "\xf0\x9d\x94\x87", false },
+    { "ctdot", "\xe2\x8b\xaf", false },
+    { "tilde", "\xcb\x9c", false },
+    { "hArr", "\xe2\x87\x94", false },
+    { "succsim", "\xe2\x89\xbf", false },
+    { "commat", "\x40", false },
+    { "sqcap", "\xe2\x8a\x93", false },
+    { "diam", "\xe2\x8b\x84", false },
+    { "csube", "\xe2\xab\x91", false },
+    { "lpar", "\x28", false },
+    { "Sopf", "\xf0\x9d\x95\x8a", false },
+    { "lbrace", "\x7b", false },
+    { "olt", "\xe2\xa7\x80", false },
+    { "profline", "\xe2\x8c\x92", false },
+    { "Mcy", "\xd0\x9c", false },
+    { "cent", "\xc2\xa2", true },
+    { "lobrk", "\xe2\x9f\xa6", false },
+    { "sqsub", "\xe2\x8a\x8f", false },
+    { "leftarrowtail", "\xe2\x86\xa2", false },
+    { "lbrke", "\xe2\xa6\x8b", false },
+    { "bigcirc", "\xe2\x97\xaf", false },
+    { "rtrif", "\xe2\x96\xb8", false },
+    { "nrightarrow", "\xe2\x86\x9b", false },
+    { "LeftDownVectorBar", "\xe2\xa5\x99", false },
+    { "clubsuit", "\xe2\x99\xa3", false },
+    { "DoubleUpDownArrow", "\xe2\x87\x95", false },
+    { "lsimg", "\xe2\xaa\x8f", false },
+    { "bkarow", "\xe2\xa4\x8d", false },
+    { "capbrcup", "\xe2\xa9\x89", false },
+    { "nparsl", "\xe2\xab\xbd\xe2\x83\xa5", false },
+    { "in", "\xe2\x88\x88", false },
+    { "Xopf", "\xf0\x9d\x95\x8f", false },
+    { "horbar", "\xe2\x80\x95", false },
+    { "NotRightTriangleBar", "\xe2\xa7\x90\xcc\xb8", false },
+    { "dotplus", "\xe2\x88\x94", false },
+    { "minusb", "\xe2\x8a\x9f", false },
+    { "DownRightVector", "\xe2\x87\x81", false },
+    { "PrecedesEqual", "\xe2\xaa\xaf", false },
+    { "rarrc", "\xe2\xa4\xb3", false },
+    { "natural", "\xe2\x99\xae", false },
+    { "gesl", "\xe2\x8b\x9b\xef\xb8\x80", false },
+    { "rsquo", "\xe2\x80\x99", false },
+    { "eplus", "\xe2\xa9\xb1", false },
+    { "toea", "\xe2\xa4\xa8", false },
+    { "nsupset", "\xe2\x8a\x83\xe2\x83\x92", false },
+    { "kgreen", "\xc4\xb8", false },
+    { "RightDownVector", "\xe2\x87\x82", false },
+    { "zwnj", "\xe2\x80\x8c", false },
+    { "loarr", "\xe2\x87\xbd", false },
+    { "NotNestedGreaterGreater", "\xe2\xaa\xa2\xcc\xb8", false },
+    { "nequiv", "\xe2\x89\xa2", false },
+    { "lvertneqq", "\xe2\x89\xa8\xef\xb8\x80", false },
+    { "ReverseUpEquilibrium", "\xe2\xa5\xaf", false },
+    { "propto", "\xe2\x88\x9d", false },
+    { "kappav", "\xcf\xb0", false },
+    { "succneqq", "\xe2\xaa\xb6", false },
+    { "tscr", "\xf0\x9d\x93\x89", false },
+    { "ngtr", "\xe2\x89\xaf", false },
+    { "Darr", "\xe2\x86\xa1", false },
+    { "lotimes", "\xe2\xa8\xb4", false },
+    { "ltlarr", "\xe2\xa5\xb6", false },
+    { "DoubleContourIntegral", "\xe2\x88\xaf", false },
+    { "cir", "\xe2\x97\x8b", false },
+    { "ZHcy", "\xd0\x96", false },
+    { "infintie", "\xe2\xa7\x9d", false },
+    { "simlE", "\xe2\xaa\x9f", false },
+    { "apos", "\x27", false },
+    { "angrtvbd", "\xe2\xa6\x9d", false },
+    { "utdot", "\xe2\x8b\xb0", false },
+    { "blk34", "\xe2\x96\x93", false },
+    { "NotSquareSubset", "\xe2\x8a\x8f\xcc\xb8", false },
+    { "marker", "\xe2\x96\xae", false },
+    { "ltrif", "\xe2\x97\x82", false },
+    { "ggg", "\xe2\x8b\x99", false },
+    { "plustwo", "\xe2\xa8\xa7", false },
+    { "LeftUpTeeVector", "\xe2\xa5\xa0", false },
+    { "OverBar", "\xe2\x80\xbe", false },
+    { "or", "\xe2\x88\xa8", false },
+    { "lsim", "\xe2\x89\xb2", false },
+    { "bopf", "\xf0\x9d\x95\x93", false },
+    { "Ograve", "\xc3\x92", true },
+    { "olcross", "\xe2\xa6\xbb", false },
+    { "origof", "\xe2\x8a\xb6", false },
+    { "auml", "\xc3\xa4", true },
+    { "lAtail", "\xe2\xa4\x9b", false },
+    { "precnsim", "\xe2\x8b\xa8", false },
+    { "boxHU", "\xe2\x95\xa9", false },
+    { "GreaterTilde", "\xe2\x89\xb3", false },
+    { "strns", "\xc2\xaf", false },
+    { "hookrightarrow", "\xe2\x86\xaa", false },
+    { "YUcy", "\xd0\xae", false },
+    { "luruhar", "\xe2\xa5\xa6", false },
+    { "ultri", "\xe2\x97\xb8", false },
+    { "Vopf", "\xf0\x9d\x95\x8d", false },
+    { "DoubleLongLeftRightArrow", "\xe2\x9f\xba", false },
+    { "Longleftarrow", "\xe2\x9f\xb8", false },
+    { "angmsd", "\xe2\x88\xa1", false },
+    { "Ucirc", "\xc3\x9b", true },
+    { "leftthreetimes", "\xe2\x8b\x8b", false },
+    { "efDot", "\xe2\x89\x92", false },
+    { "vDash", "\xe2\x8a\xa8", false },
+    { "loplus", "\xe2\xa8\xad", false },
+    { "nwarrow", "\xe2\x86\x96", false },
+    { "xsqcup", "\xe2\xa8\x86", false },
+    { "orv", "\xe2\xa9\x9b", false },
+    { "delta", "\xce\xb4", false },
+    { "profsurf", "\xe2\x8c\x93", false },
+    { "ljcy", "\xd1\x99", false },
+    { "kcedil", "\xc4\xb7", false },
+    { "yen", "\xc2\xa5", true },
+    { "icirc", "\xc3\xae", true },
+    { "ldrushar", "\xe2\xa5\x8b", false },
+    { "phone", "\xe2\x98\x8e", false },
+    { "hbar", "\xe2\x84\x8f", false },
+    { "Ccirc", "\xc4\x88", false },
+    { "div", "\xc3\xb7", false },
+    { "nleq", "\xe2\x89\xb0", false },
+    { "ocirc", "\xc3\xb4", true },
+    { "HumpDownHump", "\xe2\x89\x8e", false },
+    { "para", "\xc2\xb6", true },
+    { "lambda", "\xce\xbb", false },
+    { "supedot", "\xe2\xab\x84", false },
+    { "nlsim", "\xe2\x89\xb4", false },
+    { "loz", "\xe2\x97\x8a", false },
+    { "backcong", "\xe2\x89\x8c", false },
+    { "Iogon", "\xc4\xae", false },
+    { "lhard", "\xe2\x86\xbd", false },
+    { "malt", "\xe2\x9c\xa0", false },
+    { "lmoustache", "\xe2\x8e\xb0", false },
+    { "scsim", "\xe2\x89\xbf", false },
+    { "abreve", "\xc4\x83", false },
+    { "Atilde", "\xc3\x83", true },
+    { "risingdotseq", "\xe2\x89\x93", false },
+    { "ENG", "\xc5\x8a", false },
+    { "Lcaron", "\xc4\xbd", false },
+    { "iecy", "\xd0\xb5", false },
+    { "pscr", "\xf0\x9d\x93\x85", false },
+    { "yuml", "\xc3\xbf", true },
+    { "angrtvb", "\xe2\x8a\xbe", false },
+    { "vsubne", "\xe2\x8a\x8a\xef\xb8\x80", false },
+    { "succcurlyeq", "\xe2\x89\xbd", false },
+    { "Cross", "\xe2\xa8\xaf", false },
+    { "ycirc", "\xc5\xb7", false },
+    { "NotLessTilde", "\xe2\x89\xb4", false },
+    { "LeftUpDownVector", "\xe2\xa5\x91", false },
+    { "leq", "\xe2\x89\xa4", false },
+    { "precsim", "\xe2\x89\xbe", false },
+    { "Qfr", "\xf0\x9d\x94\x94", false },
+    { "tbrk", "\xe2\x8e\xb4", false },
+    { "Vdash", "\xe2\x8a\xa9", false },
+    { "Efr", "\xf0\x9d\x94\x88", false },
+    { "ETH", "\xc3\x90", true },
+    { "odot", "\xe2\x8a\x99", false },
+    { "gneq", "\xe2\xaa\x88", false },
+    { "FilledSmallSquare", "\xe2\x97\xbc", false },
+    { "upsi", "\xcf\x85", false },
+    { "eqsim", "\xe2\x89\x82", false },
+    { "trisb", "\xe2\xa7\x8d", false },
+    { "Exists", "\xe2\x88\x83", false },
+    { "bsol", "\x5c", false },
+    { "fjlig", "\x66\x6a", false },
+    { "profalar", "\xe2\x8c\xae", false },
+    { "Gfr", "\xf0\x9d\x94\x8a", false },
+    { "tint", "\xe2\x88\xad", false },
+    { "Jfr", "\xf0\x9d\x94\x8d", false },
+    { "UpArrowBar", "\xe2\xa4\x92", false },
+    { "LeftDoubleBracket", "\xe2\x9f\xa6", false },
+    { "ssetmn", "\xe2\x88\x96", false },
+    { "pluse", "\xe2\xa9\xb2", false },
+    { "fllig", "\xef\xac\x82", false },
+    { "hairsp", "\xe2\x80\x8a", false },
+    { "supplus", "\xe2\xab\x80", false },
+    { "larrtl", "\xe2\x86\xa2", false },
+    { "planck", "\xe2\x84\x8f", false },
+    { "num", "\x23", false },
+    { "kscr", "\xf0\x9d\x93\x80", false },
+    { "triangleq", "\xe2\x89\x9c", false },
+    { "epsi", "\xce\xb5", false },
+    { "Ecaron", "\xc4\x9a", false },
+    { "LeftRightVector", "\xe2\xa5\x8e", false },
+    { "scedil", "\xc5\x9f", false },
+    { "Sc", "\xe2\xaa\xbc", false },
+    { "HilbertSpace", "\xe2\x84\x8b", false },
+    { "sopf", "\xf0\x9d\x95\xa4", false },
+    { "Colon", "\xe2\x88\xb7", false },
+    { "Xscr", "\xf0\x9d\x92\xb3", false },
+    { "pr", "\xe2\x89\xba", false },
+    { "rmoust", "\xe2\x8e\xb1", false },
+    { "curlyvee", "\xe2\x8b\x8e", false },
+    { "nscr", "\xf0\x9d\x93\x83", false },
+    { "Yacute", "\xc3\x9d", true },
+    { "subplus", "\xe2\xaa\xbf", false },
+    { "preceq", "\xe2\xaa\xaf", false },
+    { "utrif", "\xe2\x96\xb4", false },
+    { "npreceq", "\xe2\xaa\xaf\xcc\xb8", false },
+    { "boxdR", "\xe2\x95\x92", false },
+    { "setmn", "\xe2\x88\x96", false },
+    { "OverParenthesis", "\xe2\x8f\x9c", false },
+    { "vsupnE", "\xe2\xab\x8c\xef\xb8\x80", false },
+    { "Bopf", "\xf0\x9d\x94\xb9", false },
+    { "emptyset", "\xe2\x88\x85", false },
+    { "vsupne", "\xe2\x8a\x8b\xef\xb8\x80", false },
+    { "ring", "\xcb\x9a", false },
+    { "DoubleLeftTee", "\xe2\xab\xa4", false },
+    { "vartriangleleft", "\xe2\x8a\xb2", false },
+    { "nearhk", "\xe2\xa4\xa4", false },
+    { "angle", "\xe2\x88\xa0", false },
+    { "twixt", "\xe2\x89\xac", false },
+    { "natur", "\xe2\x99\xae", false },
+    { "Ntilde", "\xc3\x91", true },
+    { "UpArrowDownArrow", "\xe2\x87\x85", false },
+    { "efr", "\xf0\x9d\x94\xa2", false },
+    { "Ncedil", "\xc5\x85", false },
+    { "boxminus", "\xe2\x8a\x9f", false },
+    { "gbreve", "\xc4\x9f", false },
+    { "larrbfs", "\xe2\xa4\x9f", false },
+    { "NotLessGreater", "\xe2\x89\xb8", false },
+    { "eqcolon", "\xe2\x89\x95", false },
+    { "rArr", "\xe2\x87\x92", false },
+    { "nRightarrow", "\xe2\x87\x8f", false },
+    { "rsaquo", "\xe2\x80\xba", false },
+    { "sup", "\xe2\x8a\x83", false },
+    { "urtri", "\xe2\x97\xb9", false },
+    { "boxul", "\xe2\x94\x98", false },
+    { "centerdot", "\xc2\xb7", false },
+    { "acute", "\xc2\xb4", true },
+    { "gE", "\xe2\x89\xa7", false },
+    { "lneqq", "\xe2\x89\xa8", false },
+    { "Uscr", "\xf0\x9d\x92\xb0", false },
+    { "male", "\xe2\x99\x82", false },
+    { "nvsim", "\xe2\x88\xbc\xe2\x83\x92", false },
+    { "lnsim", "\xe2\x8b\xa6", false },
+    { "raquo", "\xc2\xbb", true },
+    { "UnderBrace", "\xe2\x8f\x9f", false },
+    { "boxVR", "\xe2\x95\xa0", false },
+    { "die", "\xc2\xa8", false },
+    { "xuplus", "\xe2\xa8\x84", false },
+    { "RuleDelayed", "\xe2\xa7\xb4", false },
+    { "topfork", "\xe2\xab\x9a", false },
+    { "Ropf", "\xe2\x84\x9d", false },
+    { "nesim", "\xe2\x89\x82\xcc\xb8", false },
+    { "models", "\xe2\x8a\xa7", false },
+    { "circlearrowright", "\xe2\x86\xbb", false },
+    { "forkv", "\xe2\xab\x99", false },
+    { "rsquor", "\xe2\x80\x99", false },
+    { "caps", "\xe2\x88\xa9\xef\xb8\x80", false },
+    { "downdownarrows", "\xe2\x87\x8a", false },
+    { "ubrcy", "\xd1\x9e", false },
+    { "boxvL", "\xe2\x95\xa1", false },
+    { "NegativeThinSpace", "\xe2\x80\x8b", false },
+    { "afr", "\xf0\x9d\x94\x9e", false },
+    { "dlcrop", "\xe2\x8c\x8d", false },
+    { "angmsdaf", "\xe2\xa6\xad", false },
+    { "rfloor", "\xe2\x8c\x8b", false },
+    { "NotSquareSuperset", "\xe2\x8a\x90\xcc\xb8", false },
+    { "Wopf", "\xf0\x9d\x95\x8e", false },
+    { "boxV", "\xe2\x95\x91", false },
+    { "succnsim", "\xe2\x8b\xa9", false },
+    { "amacr", "\xc4\x81", false },
+    { "euml", "\xc3\xab", true },
+    { "Gbreve", "\xc4\x9e", false },
+    { "numsp", "\xe2\x80\x87", false },
+    { "DownLeftVectorBar", "\xe2\xa5\x96", false },
+    { "iff", "\xe2\x87\x94", false },
+    { "bsime", "\xe2\x8b\x8d", false },
+    { "Iukcy", "\xd0\x86", false },
+    { "tosa", "\xe2\xa4\xa9", false },
+    { "geqq", "\xe2\x89\xa7", false },
+    { "ofr", "\xf0\x9d\x94\xac", false },
+    { "bprime", "\xe2\x80\xb5", false },
+    { "olarr", "\xe2\x86\xba", false },
+    { "cupcup", "\xe2\xa9\x8a", false },
+    { "blacktriangleleft", "\xe2\x97\x82", false },
+    { "Rang", "\xe2\x9f\xab", false },
+    { "twoheadleftarrow", "\xe2\x86\x9e", false },
+    { "ccupssm", "\xe2\xa9\x90", false },
+    { "xdtri", "\xe2\x96\xbd", false },
+    { "rsh", "\xe2\x86\xb1", false },
+    { "imped", "\xc6\xb5", false },
+    { "hearts", "\xe2\x99\xa5", false },
+    { "topcir", "\xe2\xab\xb1", false },
+    { "simg", "\xe2\xaa\x9e", false },
+    { "gimel", "\xe2\x84\xb7", false },
+    { "Because", "\xe2\x88\xb5", false },
+    { "Umacr", "\xc5\xaa", false },
+    { "nleftrightarrow", "\xe2\x86\xae", false },
+    { "nLtv", "\xe2\x89\xaa\xcc\xb8", false },
+    { "emsp14", "\xe2\x80\x85", false },
+    { "SupersetEqual", "\xe2\x8a\x87", false },
+    { "longleftrightarrow", "\xe2\x9f\xb7", false },
+    { "frac58", "\xe2\x85\x9d", false },
+    { "gescc", "\xe2\xaa\xa9", false },
+    { "GreaterSlantEqual", "\xe2\xa9\xbe", false },
+    { "xmap", "\xe2\x9f\xbc", false },
+    { "nwarr", "\xe2\x86\x96", false },
+    { "gesdot", "\xe2\xaa\x80", false },
+    { "HorizontalLine", "\xe2\x94\x80", false },
+    { "Fscr", "\xe2\x84\xb1", false },
+    { "gesles", "\xe2\xaa\x94", false },
+    { "Aogon", "\xc4\x84", false },
+    { "GreaterEqual", "\xe2\x89\xa5", false },
+    { "rAtail", "\xe2\xa4\x9c", false },
+    { "leftarrow", "\xe2\x86\x90", false },
+    { "female", "\xe2\x99\x80", false },
+    { "Esim", "\xe2\xa9\xb3", false },
+    { "subne", "\xe2\x8a\x8a", false },
+    { "Uuml", "\xc3\x9c", true },
+    { "LeftCeiling", "\xe2\x8c\x88", false },
+    { "gtdot", "\xe2\x8b\x97", false },
+    { "shy", "\xc2\xad", true },
+    { "nltrie", "\xe2\x8b\xac", false },
+    { "cupdot", "\xe2\x8a\x8d", false },
+    { "mldr", "\xe2\x80\xa6", false },
+    { "capand", "\xe2\xa9\x84", false },
+    { "Hscr", "\xe2\x84\x8b", false },
+    { "TSHcy", "\xd0\x8b", false },
+    { "leqslant", "\xe2\xa9\xbd", false },
+    { "NJcy", "\xd0\x8a", false },
+    { "trianglerighteq", "\xe2\x8a\xb5", false },
+    { "AMP", "\x26", true },
+    { "ouml", "\xc3\xb6", true },
+    { "csup", "\xe2\xab\x90", false },
+    { "nesear", "\xe2\xa4\xa8", false },
+    { "Ccaron", "\xc4\x8c", false },
+    { "sqcups", "\xe2\x8a\x94\xef\xb8\x80", false },
+    { "gtcir", "\xe2\xa9\xba", false },
+    { "PrecedesTilde", "\xe2\x89\xbe", false },
+    { "bigstar", "\xe2\x98\x85", false },
+    { "Dstrok", "\xc4\x90", false },
+    { "Gopf", "\xf0\x9d\x94\xbe", false },
+    { "FilledVerySmallSquare", "\xe2\x96\xaa", false },
+    { "vert", "\x7c", false },
+    { "umacr", "\xc5\xab", false },
+    { "ni", "\xe2\x88\x8b", false },
+    { "middot", "\xc2\xb7", true },
+    { "DiacriticalTilde", "\xcb\x9c", false },
+    { "llcorner", "\xe2\x8c\x9e", false },
+    { "lbarr", "\xe2\xa4\x8c", false },
+    { "gamma", "\xce\xb3", false },
+    { "KJcy", "\xd0\x8c", false },
+    { "NestedGreaterGreater", "\xe2\x89\xab", false },
+    { "SOFTcy", "\xd0\xac", false },
+    { "gtrless", "\xe2\x89\xb7", false },
+    { "vnsub", "\xe2\x8a\x82\xe2\x83\x92", false },
+    { "nvap", "\xe2\x89\x8d\xe2\x83\x92", false },
+    { "ShortDownArrow", "\xe2\x86\x93", false },
+    { "daleth", "\xe2\x84\xb8", false },
+    { "eg", "\xe2\xaa\x9a", false },
+    { "mDDot", "\xe2\x88\xba", false },
+    { "Kscr", "\xf0\x9d\x92\xa6", false },
+    { "ascr", "\xf0\x9d\x92\xb6", false },
+    { "NotGreaterSlantEqual", "\xe2\xa9\xbe\xcc\xb8", false },
+    { "blk12", "\xe2\x96\x92", false },
+    { "rightsquigarrow", "\xe2\x86\x9d", false },
+    { "SucceedsTilde", "\xe2\x89\xbf", false },
+    { "block", "\xe2\x96\x88", false },
+    { "Proportional", "\xe2\x88\x9d", false },
+    { "upharpoonright", "\xe2\x86\xbe", false },
+    { "nleqslant", "\xe2\xa9\xbd\xcc\xb8", false },
+    { "hardcy", "\xd1\x8a", false },
+    { "LeftRightArrow", "\xe2\x86\x94", false },
+    { "xodot", "\xe2\xa8\x80", false },
+    { "intercal", "\xe2\x8a\xba", false },
+    { "varrho", "\xcf\xb1", false },
+    { "THORN", "\xc3\x9e", true },
+    { "boxplus", "\xe2\x8a\x9e", false },
+    { "dbkarow", "\xe2\xa4\x8f", false },
+    { "iexcl", "\xc2\xa1", true },
+    { "lowast", "\xe2\x88\x97", false },
+    { "Gdot", "\xc4\xa0", false },
+    { "lcub", "\x7b", false },
+    { "frac12", "\xc2\xbd", true },
+    { "Rsh", "\xe2\x86\xb1", false },
+    { "NewLine", "\x0a", false },
+    { "boxUR", "\xe2\x95\x9a", false },
+    { "egs", "\xe2\xaa\x96", false },
+    { "uacute", "\xc3\xba", true },
+    { "RightUpVector", "\xe2\x86\xbe", false },
+    { "ulcorner", "\xe2\x8c\x9c", false },
+    { "lsh", "\xe2\x86\xb0", false },
+    { "Leftarrow", "\xe2\x87\x90", false },
+    { "nless", "\xe2\x89\xae", false },
+    { "omicron", "\xce\xbf", false },
+    { "mfr", "\xf0\x9d\x94\xaa", false },
+    { "gtrsim", "\xe2\x89\xb3", false },
+    { "wedbar", "\xe2\xa9\x9f", false },
+    { "biguplus", "\xe2\xa8\x84", false },
+    { "sacute", "\xc5\x9b", false },
+    { "UpperRightArrow", "\xe2\x86\x97", false },
+    { "angrt", "\xe2\x88\x9f", false },
+    { "rrarr", "\xe2\x87\x89", false },
+    { "Coproduct", "\xe2\x88\x90", false },
+    { "rarrfs", "\xe2\xa4\x9e", false },
+    { "PrecedesSlantEqual", "\xe2\x89\xbc", false },
+    { "varnothing", "\xe2\x88\x85", false },
+    { "inodot", "\xc4\xb1", false },
+    { "nsccue", "\xe2\x8b\xa1", false },
+    { "Cayleys", "\xe2\x84\xad", false },
+    { "sigmav", "\xcf\x82", false },
+    { "plusmn", "\xc2\xb1", true },
+    { "sigma", "\xcf\x83", false },
+    { "dtdot", "\xe2\x8b\xb1", false },
+    { "boxUr", "\xe2\x95\x99", false },
+    { "Breve", "\xcb\x98", false },
+    { "bsim", "\xe2\x88\xbd", false },
+    { "ltdot", "\xe2\x8b\x96", false },
+    { "Mfr", "\xf0\x9d\x94\x90", false },
+    { "boxvl", "\xe2\x94\xa4", false },
+    { "omega", "\xcf\x89", false },
+    { "NotHumpEqual", "\xe2\x89\x8f\xcc\xb8", false },
+    { "NotLess", "\xe2\x89\xae", false },
+    { "plussim", "\xe2\xa8\xa6", false },
+    { "triminus", "\xe2\xa8\xba", false },
+    { "dblac", "\xcb\x9d", false },
+    { "robrk", "\xe2\x9f\xa7", false },
+    { "Upsi", "\xcf\x92", false },
+    { "erDot", "\xe2\x89\x93", false },
+    { "scnap", "\xe2\xaa\xba", false },
+    { "drbkarow", "\xe2\xa4\x90", false },
+    { "Otimes", "\xe2\xa8\xb7", false },
+    { "rarrlp", "\xe2\x86\xac", false },
+    { "COPY", "\xc2\xa9", true },
+    { "xnis", "\xe2\x8b\xbb", false },
+    { "nvdash", "\xe2\x8a\xac", false },
+    { "dsol", "\xe2\xa7\xb6", false },
+    { "rarrhk", "\xe2\x86\xaa", false },
+    { "Colone", "\xe2\xa9\xb4", false },
+    { "bigsqcup", "\xe2\xa8\x86", false },
+    { "Assign", "\xe2\x89\x94", false },
+    { "VerticalSeparator", "\xe2\x9d\x98", false },
+    { "yopf", "\xf0\x9d\x95\xaa", false },
+    { "succeq", "\xe2\xaa\xb0", false },
+    { "erarr", "\xe2\xa5\xb1", false },
+    { "vartriangleright", "\xe2\x8a\xb3", false },
+    { "NotPrecedesEqual", "\xe2\xaa\xaf\xcc\xb8", false },
+    { "qscr", "\xf0\x9d\x93\x86", false },
+    { "CounterClockwiseContourIntegral", "\xe2\x88\xb3", false },
+    { "iacute", "\xc3\xad", true },
+    { "cross", "\xe2\x9c\x97", false },
+    { "supnE", "\xe2\xab\x8c", false },
+    { "cuepr", "\xe2\x8b\x9e", false },
+    { "yicy", "\xd1\x97", false },
+    { "rect", "\xe2\x96\xad", false },
+    { "le", "\xe2\x89\xa4", false },
+    { "lap", "\xe2\xaa\x85", false },
+    { "topf", "\xf0\x9d\x95\xa5", false },
+    { "boxh", "\xe2\x94\x80", false },
+    { "uml", "\xc2\xa8", true },
+    { "squarf", "\xe2\x96\xaa", false },
+    { "boxhu", "\xe2\x94\xb4", false },
+    { "LeftTeeArrow", "\xe2\x86\xa4", false },
+    { "hcirc", "\xc4\xa5", false },
+    { "nVdash", "\xe2\x8a\xae", false },
+    { "circleddash", "\xe2\x8a\x9d", false },
+    { "triangle", "\xe2\x96\xb5", false },
+    { "sdote", "\xe2\xa9\xa6", false },
+    { "Iopf", "\xf0\x9d\x95\x80", false },
+    { "Lcy", "\xd0\x9b", false },
+    { "nsqsupe", "\xe2\x8b\xa3", false },
+    { "coloneq", "\xe2\x89\x94", false },
+    { "Nacute", "\xc5\x83", false },
+    { "Amacr", "\xc4\x80", false },
+    { "micro", "\xc2\xb5", true },
+    { "Cacute", "\xc4\x86", false },
+    { "LJcy", "\xd0\x89", false },
+    { "Cscr", "\xf0\x9d\x92\x9e", false },
+    { "rlm", "\xe2\x80\x8f", false },
+    { "egsdot", "\xe2\xaa\x98", false },
+    { "smeparsl", "\xe2\xa7\xa4", false },
+    { "Cdot", "\xc4\x8a", false },
+    { "VerticalLine", "\x7c", false },
+    { "nexists", "\xe2\x88\x84", false },
+    { "duhar", "\xe2\xa5\xaf", false },
+    { "iprod", "\xe2\xa8\xbc", false },
+    { "ulcrop", "\xe2\x8c\x8f", false },
+    { "szlig", "\xc3\x9f", true },
+    { "shcy", "\xd1\x88", false },
+    { "ltimes", "\xe2\x8b\x89", false },
+    { "cylcty", "\xe2\x8c\xad", false },
+    { "les", "\xe2\xa9\xbd", false },
+    { "swarhk", "\xe2\xa4\xa6", false },
+    { "frac56", "\xe2\x85\x9a", false },
+    { "vee", "\xe2\x88\xa8", false },
+    { "Hopf", "\xe2\x84\x8d", false },
+    { "langle", "\xe2\x9f\xa8", false },
+    { "npart", "\xe2\x88\x82\xcc\xb8", false },
+    { "oS", "\xe2\x93\x88", false },
+    { "curlyeqprec", "\xe2\x8b\x9e", false },
+    { "rharu", "\xe2\x87\x80", false },
+    { "lmoust", "\xe2\x8e\xb0", false },
+    { "els", "\xe2\xaa\x95", false },
+    { "ddotseq", "\xe2\xa9\xb7", false },
+    { "NotLeftTriangle", "\xe2\x8b\xaa", false },
+    { "nprcue", "\xe2\x8b\xa0", false },
+    { "nparallel", "\xe2\x88\xa6", false },
+    { "igrave", "\xc3\xac", true },
+    { "sect", "\xc2\xa7", true },
+    { "permil", "\xe2\x80\xb0", false },
+    { "laquo", "\xc2\xab", true },
+    { "wcirc", "\xc5\xb5", false },
+    { "ijlig", "\xc4\xb3", false },
+    { "utilde", "\xc5\xa9", false },
+    { "ffllig", "\xef\xac\x84", false },
+    { "dcy", "\xd0\xb4", false },
+    { "colone", "\xe2\x89\x94", false },
+    { "rho", "\xcf\x81", false },
+    { "Rscr", "\xe2\x84\x9b", false },
+    { "nvrtrie", "\xe2\x8a\xb5\xe2\x83\x92", false },
+    { "DoubleDot", "\xc2\xa8", false },
+    { "lArr", "\xe2\x87\x90", false },
+    { "solb", "\xe2\xa7\x84", false },
+    { "egrave", "\xc3\xa8", true },
+    { "udhar", "\xe2\xa5\xae", false },
+    { "Pfr", "\xf0\x9d\x94\x93", false },
+    { "lthree", "\xe2\x8b\x8b", false },
+    { "acy", "\xd0\xb0", false },
+    { "nVDash", "\xe2\x8a\xaf", false },
+    { "gel", "\xe2\x8b\x9b", false },
+    { "Jopf", "\xf0\x9d\x95\x81", false },
+    { "Nfr", "\xf0\x9d\x94\x91", false },
+    { "gnsim", "\xe2\x8b\xa7", false },
+    { "boxVh", "\xe2\x95\xab", false },
+    { "subsup", "\xe2\xab\x93", false },
+    { "Vee", "\xe2\x8b\x81", false },
+    { "percnt", "\x25", false },
+    { "mid", "\xe2\x88\xa3", false },
+    { "thickapprox", "\xe2\x89\x88", false },
+    { "lessgtr", "\xe2\x89\xb6", false },
+    { "tstrok", "\xc5\xa7", false },
+    { "bumpE", "\xe2\xaa\xae", false },
+    { "dot", "\xcb\x99", false },
+    { "blacktriangleright", "\xe2\x96\xb8", false },
+    { "Edot", "\xc4\x96", false },
+    { "DoubleLongRightArrow", "\xe2\x9f\xb9", false },
+    { "SHcy", "\xd0\xa8", false },
+    { "varr", "\xe2\x86\x95", false },
+    { "ropf", "\xf0\x9d\x95\xa3", false },
+    { "spades", "\xe2\x99\xa0", false },
+    { "otimes", "\xe2\x8a\x97", false },
+    { "Vscr", "\xf0\x9d\x92\xb1", false },
+    { "eDDot", "\xe2\xa9\xb7", false },
+    { "scap", "\xe2\xaa\xb8", false },
+    { "rarrtl", "\xe2\x86\xa3", false },
+    { "Leftrightarrow", "\xe2\x87\x94", false },
+    { "UnderParenthesis", "\xe2\x8f\x9d", false },
+    { "Or", "\xe2\xa9\x94", false },
+    { "mlcp", "\xe2\xab\x9b", false },
+    { "andand", "\xe2\xa9\x95", false },
+    { "Gamma", "\xce\x93", false },
+    { "llarr", "\xe2\x87\x87", false },
+    { "cacute", "\xc4\x87", false },
+    { "NotSquareSubsetEqual", "\xe2\x8b\xa2", false },
+    { "verbar", "\x7c", false },
+    { "Acy", "\xd0\x90", false },
+    { "infin", "\xe2\x88\x9e", false },
+    { "rbrkslu", "\xe2\xa6\x90", false },
+    { "varsubsetneq", "\xe2\x8a\x8a\xef\xb8\x80", false },
+    { "larr", "\xe2\x86\x90", false },
+    { "nsubE", "\xe2\xab\x85\xcc\xb8", false },
+    { "uscr", "\xf0\x9d\x93\x8a", false },
+    { "rdca", "\xe2\xa4\xb7", false },
+    { "bepsi", "\xcf\xb6", false },
+    { "larrfs", "\xe2\xa4\x9d", false },
+    { "Ascr", "\xf0\x9d\x92\x9c", false },
+    { "bne", "\x3d\xe2\x83\xa5", false },
+    { "boxUl", "\xe2\x95\x9c", false },
+    { "TildeEqual", "\xe2\x89\x83", false },
+    { "KHcy", "\xd0\xa5", false },
+    { "tritime", "\xe2\xa8\xbb", false },
+    { "there4", "\xe2\x88\xb4", false },
+    { "capcap", "\xe2\xa9\x8b", false },
+    { "Xfr", "\xf0\x9d\x94\x9b", false },
+    { "vsubnE", "\xe2\xab\x8b\xef\xb8\x80", false },
+    { "supseteq", "\xe2\x8a\x87", false },
+    { "Lleftarrow", "\xe2\x87\x9a", false },
+    { "squ", "\xe2\x96\xa1", false },
+    { "Euml", "\xc3\x8b", true },
+    { "dstrok", "\xc4\x91", false },
+    { "Copf", "\xe2\x84\x82", false },
+    { "Longrightarrow", "\xe2\x9f\xb9", false },
+    { "bnot", "\xe2\x8c\x90", false },
+    { "rhov", "\xcf\xb1", false },
+    { "nvDash", "\xe2\x8a\xad", false },
+    { "parsl", "\xe2\xab\xbd", false },
+    { "prime", "\xe2\x80\xb2", false },
+    { "xrArr", "\xe2\x9f\xb9", false },
+    { "LessTilde", "\xe2\x89\xb2", false },
+    { "ac", "\xe2\x88\xbe", false },
+    { "frown", "\xe2\x8c\xa2", false },
+    { "ncong", "\xe2\x89\x87", false },
+    { "Zacute", "\xc5\xb9", false },
+    { "Lambda", "\xce\x9b", false },
+    { "LessLess", "\xe2\xaa\xa1", false },
+    { "curlywedge", "\xe2\x8b\x8f", false },
+    { "Vbar", "\xe2\xab\xab", false },
+    { "nedot", "\xe2\x89\x90\xcc\xb8", false },
+    { "ngsim", "\xe2\x89\xb5", false },
+    { "ltcc", "\xe2\xaa\xa6", false },
+    { "tridot", "\xe2\x97\xac", false },
+    { "Hacek", "\xcb\x87", false },
+    { "parsim", "\xe2\xab\xb3", false },
+    { "Gscr", "\xf0\x9d\x92\xa2", false },
+    { "nhArr", "\xe2\x87\x8e", false },
+    { "larrsim", "\xe2\xa5\xb3", false },
+    { "nge", "\xe2\x89\xb1", false },
+    { "rtrie", "\xe2\x8a\xb5", false },
+    { "Rcy", "\xd0\xa0", false },
+    { "NoBreak", "\xe2\x81\xa0", false },
+    { "smashp", "\xe2\xa8\xb3", false },
+    { "qfr", "\xf0\x9d\x94\xae", false },
+    { "DScy", "\xd0\x85", false },
+    { "kappa", "\xce\xba", false },
+    { "zigrarr", "\xe2\x87\x9d", false },
+    { "CloseCurlyDoubleQuote", "\xe2\x80\x9d", false },
+    { "Zcy", "\xd0\x97", false },
+    { "TildeFullEqual", "\xe2\x89\x85", false },
+    { "ldca", "\xe2\xa4\xb6", false },
+    { "parallel", "\xe2\x88\xa5", false },
+    { "cuesc", "\xe2\x8b\x9f", false },
+    { "Longleftrightarrow", "\xe2\x9f\xba", false },
+    { "rdquo", "\xe2\x80\x9d", false },
+    { "bigwedge", "\xe2\x8b\x80", false },
+    { "xotime", "\xe2\xa8\x82", false },
+    { "Fcy", "\xd0\xa4", false },
+    { "beta", "\xce\xb2", false },
+    { "Laplacetrf", "\xe2\x84\x92", false },
+    { "ycy", "\xd1\x8b", false },
+    { "Nu", "\xce\x9d", false },
+    { "boxdr", "\xe2\x94\x8c", false },
+    { "Sacute", "\xc5\x9a", false },
+    { "blk14", "\xe2\x96\x91", false },
+    { "NotCupCap", "\xe2\x89\xad", false },
+    { "SquareUnion", "\xe2\x8a\x94", false },
+    { "nLeftrightarrow", "\xe2\x87\x8e", false },
+    { "gtrdot", "\xe2\x8b\x97", false },
+    { "qint", "\xe2\xa8\x8c", false },
+    { "GreaterFullEqual", "\xe2\x89\xa7", false },
+    { "ShortLeftArrow", "\xe2\x86\x90", false },
+    { "thksim", "\xe2\x88\xbc", false },
+    { "DownLeftRightVector", "\xe2\xa5\x90", false },
+    { "rangd", "\xe2\xa6\x92", false },
+    { "capdot", "\xe2\xa9\x80", false },
+    { "scE", "\xe2\xaa\xb4", false },
+    { "ecolon", "\xe2\x89\x95", false },
+    { "wp", "\xe2\x84\x98", false },
+    { "lt", "\x3c", true },
+    { "nvge", "\xe2\x89\xa5\xe2\x83\x92", false },
+    { "LeftAngleBracket", "\xe2\x9f\xa8", false },
+    { "qopf", "\xf0\x9d\x95\xa2", false },
+    { "darr", "\xe2\x86\x93", false },
+    { "amalg", "\xe2\xa8\xbf", false },
+    { "frac45", "\xe2\x85\x98", false },
+    { "curlyeqsucc", "\xe2\x8b\x9f", false },
+    { "rdldhar", "\xe2\xa5\xa9", false },
+    { "frac15", "\xe2\x85\x95", false },
+    { "nsub", "\xe2\x8a\x84", false },
+    { "boxuL", "\xe2\x95\x9b", false },
+    { "gtreqqless", "\xe2\xaa\x8c", false },
+    { "uarr", "\xe2\x86\x91", false },
+    { "Ocirc", "\xc3\x94", true },
+    { "Theta", "\xce\x98", false },
+    { "fscr", "\xf0\x9d\x92\xbb", false },
+    { "leftrightsquigarrow", "\xe2\x86\xad", false },
+    { "el", "\xe2\xaa\x99", false },
+    { "Uopf", "\xf0\x9d\x95\x8c", false },
+    { "DiacriticalGrave", "\x60", false },
+    { "bbrktbrk", "\xe2\x8e\xb6", false },
+    { "ApplyFunction", "\xe2\x81\xa1", false },
+    { "fpartint", "\xe2\xa8\x8d", false },
+    { "TildeTilde", "\xe2\x89\x88", false },
+    { "sube", "\xe2\x8a\x86", false },
+    { "barwed", "\xe2\x8c\x85", false },
+    { "rarrbfs", "\xe2\xa4\xa0", false },
+    { "Eogon", "\xc4\x98", false },
+    { "exponentiale", "\xe2\x85\x87", false },
+    { "ominus", "\xe2\x8a\x96", false },
+    { "lcy", "\xd0\xbb", false },
+    { "OverBrace", "\xe2\x8f\x9e", false },
+    { "Dopf", "\xf0\x9d\x94\xbb", false },
+    { "ucirc", "\xc3\xbb", true },
+    { "Union", "\xe2\x8b\x83", false },
+    { "oelig", "\xc5\x93", false },
+    { "subsub", "\xe2\xab\x95", false },
+    { "gacute", "\xc7\xb5", false },
+    { "ee", "\xe2\x85\x87", false },
+    { "iiota", "\xe2\x84\xa9", false },
+    { "Ccedil", "\xc3\x87", true },
+    { "Epsilon", "\xce\x95", false },
+    { "Egrave", "\xc3\x88", true },
+    { "nsupe", "\xe2\x8a\x89", false },
+    { "harrcir", "\xe2\xa5\x88", false },
+    { "boxDR", "\xe2\x95\x94", false },
+    { "fcy", "\xd1\x84", false },
+    { "LessSlantEqual", "\xe2\xa9\xbd", false },
+    { "lacute", "\xc4\xba", false },
+    { "napid", "\xe2\x89\x8b\xcc\xb8", false },
+    { "boxdL", "\xe2\x95\x95", false },
+    { "ssmile", "\xe2\x8c\xa3", false },
+    { "quest", "\x3f", false },
+    { "sqsupe", "\xe2\x8a\x92", false },
+    { "sigmaf", "\xcf\x82", false },
+    { "OverBracket", "\xe2\x8e\xb4", false },
+    { "lsime", "\xe2\xaa\x8d", false },
+    { "tfr", "\xf0\x9d\x94\xb1", false },
+    { "DownArrowBar", "\xe2\xa4\x93", false },
+    { "fflig", "\xef\xac\x80", false },
+    { "alefsym", "\xe2\x84\xb5", false },
+    { "UpDownArrow", "\xe2\x86\x95", false },
+    { "DZcy", "\xd0\x8f", false },
+    { "and", "\xe2\x88\xa7", false },
+    { "SquareSubset", "\xe2\x8a\x8f", false },
+    { "psi", "\xcf\x88", false },
+    { "Eacute", "\xc3\x89", true },
+    { "ecy", "\xd1\x8d", false },
+    { "LessEqualGreater", "\xe2\x8b\x9a", false },
+    { "vopf", "\xf0\x9d\x95\xa7", false },
+    { "nearrow", "\xe2\x86\x97", false },
+    { "nrarrc", "\xe2\xa4\xb3\xcc\xb8", false },
+    { "divide", "\xc3\xb7", true },
+    { "supsetneq", "\xe2\x8a\x8b", false },
+    { "weierp", "\xe2\x84\x98", false },
+    { "plusdu", "\xe2\xa8\xa5", false },
+    { "Gcy", "\xd0\x93", false },
+    { "timesb", "\xe2\x8a\xa0", false },
+    { "eqslantgtr", "\xe2\xaa\x96", false },
+    { "nsucc", "\xe2\x8a\x81", false },
+    { "softcy", "\xd1\x8c", false },
+    { "sup3", "\xc2\xb3", true },
+    { "ell", "\xe2\x84\x93", false },
+    { "crarr", "\xe2\x86\xb5", false },
+    { "lharu", "\xe2\x86\xbc", false },
+    { "Phi", "\xce\xa6", false },
+    { "Bernoullis", "\xe2\x84\xac", false },
+    { "imagpart", "\xe2\x84\x91", false },
+    { "Kappa", "\xce\x9a", false },
+    { "Rcedil", "\xc5\x96", false },
+    { "nvle", "\xe2\x89\xa4\xe2\x83\x92", false },
+    { "Iacute", "\xc3\x8d", true },
+    { "bcong", "\xe2\x89\x8c", false },
+    { "Zscr", "\xf0\x9d\x92\xb5", false },
+    { "sim", "\xe2\x88\xbc", false },
+    { "InvisibleTimes", "\xe2\x81\xa2", false },
+    { "rceil", "\xe2\x8c\x89", false },
+    { "csub", "\xe2\xab\x8f", false },
+    { "dharl", "\xe2\x87\x83", false },
+    { "supseteqq", "\xe2\xab\x86", false },
+    { "vprop", "\xe2\x88\x9d", false },
+    { "Uarrocir", "\xe2\xa5\x89", false },
+    { "veeeq", "\xe2\x89\x9a", false },
+    { "boxv", "\xe2\x94\x82", false },
+    { "rightharpoondown", "\xe2\x87\x81", false },
+    { "ffr", "\xf0\x9d\x94\xa3", false },
+    { "empty", "\xe2\x88\x85", false },
+    { "Rarrtl", "\xe2\xa4\x96", false },
+    { "srarr", "\xe2\x86\x92", false },
+    { "varpropto", "\xe2\x88\x9d", false },
+    { "vltri", "\xe2\x8a\xb2", false },
+    { "dagger", "\xe2\x80\xa0", false },
+    { "IEcy", "\xd0\x95", false },
+    { "khcy", "\xd1\x85", false },
+    { "suphsub", "\xe2\xab\x97", false },
+    { "ldrdhar", "\xe2\xa5\xa7", false },
+    { "plusdo", "\xe2\x88\x94", false },
+    { "hslash", "\xe2\x84\x8f", false },
+    { "ldsh", "\xe2\x86\xb2", false },
+    { "smt", "\xe2\xaa\xaa", false },
+    { "sqsupseteq", "\xe2\x8a\x92", false },
+    { "REG", "\xc2\xae", true },
+    { "lvnE", "\xe2\x89\xa8\xef\xb8\x80", false },
+    { "simgE", "\xe2\xaa\xa0", false },
+    { "gsime", "\xe2\xaa\x8e", false },
+    { "subseteq", "\xe2\x8a\x86", false },
+    { "Bscr", "\xe2\x84\xac", false },
+    { "odash", "\xe2\x8a\x9d", false },
+    { "Tscr", "\xf0\x9d\x92\xaf", false },
+    { "DotDot", "\xe2\x83\x9c", false },
+    { "planckh", "\xe2\x84\x8e", false },
+    { "nLeftarrow", "\xe2\x87\x8d", false },
+    { "varkappa", "\xcf\xb0", false },
+    { "Iscr", "\xe2\x84\x90", false },
+    { "ZeroWidthSpace", "\xe2\x80\x8b", false },
+    { "RightUpTeeVector", "\xe2\xa5\x9c", false },
+    { "DiacriticalDoubleAcute", "\xcb\x9d", false },
+    { "becaus", "\xe2\x88\xb5", false },
+    { "DownLeftTeeVector", "\xe2\xa5\x9e", false },
+    { "bNot", "\xe2\xab\xad", false },
+    { "apid", "\xe2\x89\x8b", false },
+    { "langd", "\xe2\xa6\x91", false },
+    { "boxur", "\xe2\x94\x94", false },
+    { "LowerLeftArrow", "\xe2\x86\x99", false },
+    { "midast", "\x2a", false },
+    { "image", "\xe2\x84\x91", false },
+    { "qprime", "\xe2\x81\x97", false },
+    { "succnapprox", "\xe2\xaa\xba", false },
+    { "notinvb", "\xe2\x8b\xb7", false },
+    { "harrw", "\xe2\x86\xad", false },
+    { "Equal", "\xe2\xa9\xb5", false },
+    { "ddagger", "\xe2\x80\xa1", false },
+    { "lesssim", "\xe2\x89\xb2", false },
+    { "RightArrowLeftArrow", "\xe2\x87\x84", false },
+    { "smile", "\xe2\x8c\xa3", false },
+    { "wopf", "\xf0\x9d\x95\xa8", false },
+    { "NotLessLess", "\xe2\x89\xaa\xcc\xb8", false },
+    { "puncsp", "\xe2\x80\x88", false },
+    { "hoarr", "\xe2\x87\xbf", false },
+    { "Lang", "\xe2\x9f\xaa", false },
+    { "xcap", "\xe2\x8b\x82", false },
+    { "chi", "\xcf\x87", false },
+    { "flat", "\xe2\x99\xad", false },
+    { "VDash", "\xe2\x8a\xab", false },
+    { "andslope", "\xe2\xa9\x98", false },
+    { "zacute", "\xc5\xba", false },
+    { "mp", "\xe2\x88\x93", false },
+    { "apE", "\xe2\xa9\xb0", false },
+    { "ImaginaryI", "\xe2\x85\x88", false },
+    { "xfr", "\xf0\x9d\x94\xb5", false },
+    { "LeftTeeVector", "\xe2\xa5\x9a", false },
+    { "GreaterGreater", "\xe2\xaa\xa2", false },
+    { "emacr", "\xc4\x93", false },
+    { "NotRightTriangleEqual", "\xe2\x8b\xad", false },
+    { "ograve", "\xc3\xb2", true },
+    { "beth", "\xe2\x84\xb6", false },
+    { "gvertneqq", "\xe2\x89\xa9\xef\xb8\x80", false },
+    { "pertenk", "\xe2\x80\xb1", false },
+    { "cup", "\xe2\x88\xaa", false },
+    { "nsqsube", "\xe2\x8b\xa2", false },
+    { "lhblk", "\xe2\x96\x84", false },
+    { "solbar", "\xe2\x8c\xbf", false },
+    { "ncaron", "\xc5\x88", false },
+    { "larrb", "\xe2\x87\xa4", false },
+    { "Delta", "\xce\x94", false },
+    { "NotGreater", "\xe2\x89\xaf", false },
+    { "scirc", "\xc5\x9d", false },
+    { "Oacute", "\xc3\x93", true },
+    { "Rcaron", "\xc5\x98", false },
+    { "triplus", "\xe2\xa8\xb9", false },
+    { "Lmidot", "\xc4\xbf", false },
+    { "LeftDownTeeVector", "\xe2\xa5\xa1", false },
+    { "zwj", "\xe2\x80\x8d", false },
+    { "isindot", "\xe2\x8b\xb5", false },
+    { "gtcc", "\xe2\xaa\xa7", false },
+    { "lEg", "\xe2\xaa\x8b", false },
+    { "timesbar", "\xe2\xa8\xb1", false },
+    { "Tcy", "\xd0\xa2", false },
+    { "roang", "\xe2\x9f\xad", false },
+    { "precapprox", "\xe2\xaa\xb7", false },
+    { "nabla", "\xe2\x88\x87", false },
+    { "ncap", "\xe2\xa9\x83", false },
+    { "gtlPar", "\xe2\xa6\x95", false },
+    { "hyphen", "\xe2\x80\x90", false },
+    { "glE", "\xe2\xaa\x92", false },
+    { "xcirc", "\xe2\x97\xaf", false },
+    { "circlearrowleft", "\xe2\x86\xba", false },
+    { "iinfin", "\xe2\xa7\x9c", false },
+    { "EmptySmallSquare", "\xe2\x97\xbb", false },
+    { "GreaterEqualLess", "\xe2\x8b\x9b", false },
+    { "Supset", "\xe2\x8b\x91", false },
+    { "cire", "\xe2\x89\x97", false },
+    { "checkmark", "\xe2\x9c\x93", false },
+    { "theta", "\xce\xb8", false },
+    { "nwArr", "\xe2\x87\x96", false },
+    { "nbumpe", "\xe2\x89\x8f\xcc\xb8", false },
+    { "ord", "\xe2\xa9\x9d", false },
+    { "triangledown", "\xe2\x96\xbf", false },
+    { "fopf", "\xf0\x9d\x95\x97", false },
+    { "nvlt", "\x3c\xe2\x83\x92", false },
+    { "bfr", "\xf0\x9d\x94\x9f", false },
+    { "DoubleUpArrow", "\xe2\x87\x91", false },
+    { "LongLeftRightArrow", "\xe2\x9f\xb7", false },
+    { "larrlp", "\xe2\x86\xab", false },
+    { "rarrap", "\xe2\xa5\xb5", false },
+    { "dashv", "\xe2\x8a\xa3", false },
+    { "rsqb", "\x5d", false },
+    { "exist", "\xe2\x88\x83", false },
+    { "rationals", "\xe2\x84\x9a", false },
+    { "topbot", "\xe2\x8c\xb6", false },
+    { "Agrave", "\xc3\x80", true },
+    { "vscr", "\xf0\x9d\x93\x8b", false },
+    { "Yopf", "\xf0\x9d\x95\x90", false },
+    { "diams", "\xe2\x99\xa6", false },
+    { "eth", "\xc3\xb0", true },
+    { "Racute", "\xc5\x94", false },
+    { "nwarhk", "\xe2\xa4\xa3", false },
+    { "suphsol", "\xe2\x9f\x89", false },
+    { "supset", "\xe2\x8a\x83", false },
+    { "ecaron", "\xc4\x9b", false },
+    { "YAcy", "\xd0\xaf", false },
+    { "gEl", "\xe2\xaa\x8c", false },
+    { "Dcaron", "\xc4\x8e", false },
+    { "NotSucceeds", "\xe2\x8a\x81", false },
+    { "seArr", "\xe2\x87\x98", false },
+    { "brvbar", "\xc2\xa6", true },
+    { "supmult", "\xe2\xab\x82", false },
+    { "Mellintrf", "\xe2\x84\xb3", false },
+    { "pi", "\xcf\x80", false },
+    { "xhArr", "\xe2\x9f\xba", false },
+    { "nspar", "\xe2\x88\xa6", false },
+    { "kopf", "\xf0\x9d\x95\x9c", false },
+    { "tcaron", "\xc5\xa5", false },
+    { "mcy", "\xd0\xbc", false },
+    { "DotEqual", "\xe2\x89\x90", false },
+    { "angsph", "\xe2\x88\xa2", false },
+    { "gvnE", "\xe2\x89\xa9\xef\xb8\x80", false },
+    { "isinsv", "\xe2\x8b\xb3", false },
+    { "lE", "\xe2\x89\xa6", false },
+    { "ThinSpace", "\xe2\x80\x89", false },
+    { "nap", "\xe2\x89\x89", false },
+    { "naturals", "\xe2\x84\x95", false },
+    { "subsetneqq", "\xe2\xab\x8b", false },
+    { "complexes", "\xe2\x84\x82", false },
+    { "lurdshar", "\xe2\xa5\x8a", false },
+    { "smallsetminus", "\xe2\x88\x96", false },
+    { "boxvr", "\xe2\x94\x9c", false },
+    { "lgE", "\xe2\xaa\x91", false },
+    { "rarrw", "\xe2\x86\x9d", false },
+    { "cirscir", "\xe2\xa7\x82", false },
+    { "upharpoonleft", "\xe2\x86\xbf", false },
+    { "notinva", "\xe2\x88\x89", false },
+    { "hscr", "\xf0\x9d\x92\xbd", false },
+    { "Sub", "\xe2\x8b\x90", false },
+    { "UpArrow", "\xe2\x86\x91", false },
+    { "easter", "\xe2\xa9\xae", false },
+    { "DoubleLongLeftArrow", "\xe2\x9f\xb8", false },
+    { "between", "\xe2\x89\xac", false },
+    { "sfrown", "\xe2\x8c\xa2", false },
+    { "harr", "\xe2\x86\x94", false },
+    { "timesd", "\xe2\xa8\xb0", false },
+    { "dzigrarr", "\xe2\x9f\xbf", false },
+    { "LeftFloor", "\xe2\x8c\x8a", false },
+    { "quatint", "\xe2\xa8\x96", false },
+    { "notin", "\xe2\x88\x89", false },
+    { "sbquo", "\xe2\x80\x9a", false },
+    { "NotTildeTilde", "\xe2\x89\x89", false },
+    { "boxHu", "\xe2\x95\xa7", false },
+    { "race", "\xe2\x88\xbd\xcc\xb1", false },
+    { "nsim", "\xe2\x89\x81", false },
+    { "Iota", "\xce\x99", false },
+    { "roarr", "\xe2\x87\xbe", false },
+    { "tshcy", "\xd1\x9b", false },
+    { "minusd", "\xe2\x88\xb8", false },
+    { "LeftTriangleBar", "\xe2\xa7\x8f", false },
+    { "Ubreve", "\xc5\xac", false },
+    { "vdash", "\xe2\x8a\xa2", false },
+    { "iocy", "\xd1\x91", false },
+    { "Oscr", "\xf0\x9d\x92\xaa", false },
+    { "prnap", "\xe2\xaa\xb9", false },
+    { "RightDownTeeVector", "\xe2\xa5\x9d", false },
+    { "caret", "\xe2\x81\x81", false },
+    { "Tilde", "\xe2\x88\xbc", false },
+    { "sqsube", "\xe2\x8a\x91", false },
+    { "bdquo", "\xe2\x80\x9e", false },
+    { "supE", "\xe2\xab\x86", false },
+    { "ntgl", "\xe2\x89\xb9", false },
+    { "upsilon", "\xcf\x85", false },
+    { "olcir", "\xe2\xa6\xbe", false },
+    { "rHar", "\xe2\xa5\xa4", false },
+    { "fallingdotseq", "\xe2\x89\x92", false },
+    { "rmoustache", "\xe2\x8e\xb1", false },
+    { "spar", "\xe2\x88\xa5", false },
+    { "Psi", "\xce\xa8", false },
+    { "boxdl", "\xe2\x94\x90", false },
+    { "ratio", "\xe2\x88\xb6", false },
+    { "notni", "\xe2\x88\x8c", false },
+    { "rarrsim", "\xe2\xa5\xb4", false },
+    { "nvlArr", "\xe2\xa4\x82", false },
+    { "Ugrave", "\xc3\x99", true },
+    { "vrtri", "\xe2\x8a\xb3", false },
+    { "gtquest", "\xe2\xa9\xbc", false },
+    { "ic", "\xe2\x81\xa3", false },
+    { "late", "\xe2\xaa\xad", false },
+    { "Udblac", "\xc5\xb0", false },
+    { "incare", "\xe2\x84\x85", false },
+    { "notindot", "\xe2\x8b\xb5\xcc\xb8", false },
+    { "mstpos", "\xe2\x88\xbe", false },
+    { "And", "\xe2\xa9\x93", false },
+    { "boxhU", "\xe2\x95\xa8", false },
+    { "dollar", "\x24", false },
+    { "DifferentialD", "\xe2\x85\x86", false },
+    { "comp", "\xe2\x88\x81", false },
+    { "nsupE", "\xe2\xab\x86\xcc\xb8", false },
+    { "xvee", "\xe2\x8b\x81", false },
+    { "Cfr", "\xe2\x84\xad", false },
+    { "vellip", "\xe2\x8b\xae", false },
+    { "looparrowleft", "\xe2\x86\xab", false },
+    { "eacute", "\xc3\xa9", true },
+    { "dscr", "\xf0\x9d\x92\xb9", false },
+    { "Dscr", "\xf0\x9d\x92\x9f", false },
+    { "precnapprox", "\xe2\xaa\xb9", false },
+    { "nprec", "\xe2\x8a\x80", false },
+    { "DiacriticalAcute", "\xc2\xb4", false },
+    { "oint", "\xe2\x88\xae", false },
+    { "nsube", "\xe2\x8a\x88", false },
+    { "iukcy", "\xd1\x96", false },
+    { "gl", "\xe2\x89\xb7", false },
+    { "frac78", "\xe2\x85\x9e", false },
+    { "mapsto", "\xe2\x86\xa6", false },
+    { "nleqq", "\xe2\x89\xa6\xcc\xb8", false },
+    { "kcy", "\xd0\xba", false },
+    { "nrarr", "\xe2\x86\x9b", false },
+    { "submult", "\xe2\xab\x81", false },
+    { "vcy", "\xd0\xb2", false },
+    { "boxvR", "\xe2\x95\x9e", false },
+    { "eng", "\xc5\x8b", false },
+    { "mdash", "\xe2\x80\x94", false },
+    { "ast", "\x2a", false },
+    { "nfr", "\xf0\x9d\x94\xab", false },
+    { "Star", "\xe2\x8b\x86", false },
+    { "awint", "\xe2\xa8\x91", false },
+    { "not", "\xc2\xac", true },
+    { "thicksim", "\xe2\x88\xbc", false },
+    { "NotSucceedsTilde", "\xe2\x89\xbf\xcc\xb8", false },
+    { "Tab", "\x09", false },
+    { "reals", "\xe2\x84\x9d", false },
+    { "nsup", "\xe2\x8a\x85", false },
+    { "Gcedil", "\xc4\xa2", false },
+    { "Lt", "\xe2\x89\xaa", false },
+    { "vangrt", "\xe2\xa6\x9c", false },
+    { "sime", "\xe2\x89\x83", false },
+    { "bernou", "\xe2\x84\xac", false },
+    { "approxeq", "\xe2\x89\x8a", false },
+    { "oror", "\xe2\xa9\x96", false },
+    { "njcy", "\xd1\x9a", false },
+    { "filig", "\xef\xac\x81", false },
+    { "leftrightarrow", "\xe2\x86\x94", false },
+    { "nvrArr", "\xe2\xa4\x83", false },
+    { "cularrp", "\xe2\xa4\xbd", false },
+    { "rhard", "\xe2\x87\x81", false },
+    { "GJcy", "\xd0\x83", false },
+    { "udblac", "\xc5\xb1", false },
+    { "rppolint", "\xe2\xa8\x92", false },
+    { "nrarrw", "\xe2\x86\x9d\xcc\xb8", false },
+    { "pointint", "\xe2\xa8\x95", false },
+    { "SquareSupersetEqual", "\xe2\x8a\x92", false },
+    { "eDot", "\xe2\x89\x91", false },
+    { "SucceedsEqual", "\xe2\xaa\xb0", false },
+    { "frac35", "\xe2\x85\x97", false },
+    { "eta", "\xce\xb7", false },
+    { "iopf", "\xf0\x9d\x95\x9a", false },
+    { "maltese", "\xe2\x9c\xa0", false },
+    { "drcorn", "\xe2\x8c\x9f", false },
+    { "veebar", "\xe2\x8a\xbb", false },
+    { "RightArrowBar", "\xe2\x87\xa5", false },
+    { "napos", "\xc5\x89", false },
+    { "CircleMinus", "\xe2\x8a\x96", false },
+    { "angmsdae", "\xe2\xa6\xac", false },
+    { "UpperLeftArrow", "\xe2\x86\x96", false },
+    { "sfr", "\xf0\x9d\x94\xb0", false },
+    { "prurel", "\xe2\x8a\xb0", false },
+    { "iota", "\xce\xb9", false },
+    { "tcy", "\xd1\x82", false },
+    { "npre", "\xe2\xaa\xaf\xcc\xb8", false },
+    { "Int", "\xe2\x88\xac", false },
+    { "nisd", "\xe2\x8b\xba", false },
+    { "tdot", "\xe2\x83\x9b", false },
+    { "minus", "\xe2\x88\x92", false },
+    { "sum", "\xe2\x88\x91", false },
+    { "Lopf", "\xf0\x9d\x95\x83", false },
+    { "nsubseteq", "\xe2\x8a\x88", false },
+    { "iogon", "\xc4\xaf", false },
+    { "raemptyv", "\xe2\xa6\xb3", false },
+    { "Hstrok", "\xc4\xa6", false },
+    { "rx", "\xe2\x84\x9e", false },
+    { "simdot", "\xe2\xa9\xaa", false },
+    { "zeetrf", "\xe2\x84\xa8", false },
+    { "Vcy", "\xd0\x92", false },
+    { "lsquor", "\xe2\x80\x9a", false },
+    { "Succeeds", "\xe2\x89\xbb", false },
+    { "cupbrcap", "\xe2\xa9\x88", false },
+    { "swarr", "\xe2\x86\x99", false },
+    { "SmallCircle", "\xe2\x88\x98", false },
+    { "xharr", "\xe2\x9f\xb7", false },
+    { "part", "\xe2\x88\x82", false },
+    { "dd", "\xe2\x85\x86", false },
+    { "rightarrow", "\xe2\x86\x92", false },
+    { "gt", "\x3e", true },
+    { "RightDoubleBracket", "\xe2\x9f\xa7", false },
+    { "Tau", "\xce\xa4", false },
+    { "yucy", "\xd1\x8e", false },
+    { "circ", "\xcb\x86", false },
+    { "Wfr", "\xf0\x9d\x94\x9a", false },
+    { "ReverseEquilibrium", "\xe2\x87\x8b", false },
+    { "NotLessSlantEqual", "\xe2\xa9\xbd\xcc\xb8", false },
+    { "xlarr", "\xe2\x9f\xb5", false },
+    { "UnionPlus", "\xe2\x8a\x8e", false },
+    { "sce", "\xe2\xaa\xb0", false },
+    { "ofcir", "\xe2\xa6\xbf", false },
+    { "bigotimes", "\xe2\xa8\x82", false },
+    { "rcub", "\x7d", false },
+    { "LessFullEqual", "\xe2\x89\xa6", false },
+    { "hfr", "\xf0\x9d\x94\xa5", false },
+    { "LeftArrow", "\xe2\x86\x90", false },
+    { "copy", "\xc2\xa9", true },
+    { "nlArr", "\xe2\x87\x8d", false },
+    { "angmsdac", "\xe2\xa6\xaa", false },
+    { "trie", "\xe2\x89\x9c", false },
+    { "NotPrecedesSlantEqual", "\xe2\x8b\xa0", false },
+    { "lfloor", "\xe2\x8c\x8a", false },
+    { "prap", "\xe2\xaa\xb7", false },
+    { "rlhar", "\xe2\x87\x8c", false },
+    { "Ycirc", "\xc5\xb6", false },
+    { "nmid", "\xe2\x88\xa4", false },
+    { "DownLeftVector", "\xe2\x86\xbd", false },
+    { "esdot", "\xe2\x89\x90", false },
+    { "cfr", "\xf0\x9d\x94\xa0", false },
+    { "nlt", "\xe2\x89\xae", false },
+    { "boxHd", "\xe2\x95\xa4", false },
+    { "NotEqual", "\xe2\x89\xa0", false },
+    { "emsp", "\xe2\x80\x83", false },
+    { "Ocy", "\xd0\x9e", false },
+    { "RightVector", "\xe2\x87\x80", false },
+    { "nsimeq", "\xe2\x89\x84", false },
+    { "Dot", "\xc2\xa8", false },
+    { "lessapprox", "\xe2\xaa\x85", false },
+    { "apacir", "\xe2\xa9\xaf", false },
+    { "isins", "\xe2\x8b\xb4", false },
+    { "expectation", "\xe2\x84\xb0", false },
+    { "urcorner", "\xe2\x8c\x9d", false },
+    { "vBarv", "\xe2\xab\xa9", false },
+    { "dArr", "\xe2\x87\x93", false },
+    { "angst", "\xc3\x85", false },
+    { "DownTee", "\xe2\x8a\xa4", false },
+    { "nleftarrow", "\xe2\x86\x9a", false },
+    { "Zeta", "\xce\x96", false },
+    { "rangle", "\xe2\x9f\xa9", false },
+    { "orderof", "\xe2\x84\xb4", false },
+    { "mnplus", "\xe2\x88\x93", false },
+    { "Poincareplane", "\xe2\x84\x8c", false },
+    { "boxH", "\xe2\x95\x90", false },
+    { "Itilde", "\xc4\xa8", false },
+    { "boxbox", "\xe2\xa7\x89", false },
+    { "nGg", "\xe2\x8b\x99\xcc\xb8", false },
+    { "Map", "\xe2\xa4\x85", false },
+    { "supne", "\xe2\x8a\x8b", false },
+    { "telrec", "\xe2\x8c\x95", false },
+    { "HARDcy", "\xd0\xaa", false },
+    { "frac34", "\xc2\xbe", true },
+    { "cscr", "\xf0\x9d\x92\xb8", false },
+    { "urcorn", "\xe2\x8c\x9d", false },
+    { "lltri", "\xe2\x97\xba", false },
+    { "odblac", "\xc5\x91", false },
+    { "disin", "\xe2\x8b\xb2", false },
+    { "ccaps", "\xe2\xa9\x8d", false },
+    { "ngeq", "\xe2\x89\xb1", false },
+    { "Icy", "\xd0\x98", false },
+    { "trpezium", "\xe2\x8f\xa2", false },
+    { "SHCHcy", "\xd0\xa9", false },
+    { "Alpha", "\xce\x91", false },
+    { "Mscr", "\xe2\x84\xb3", false },
+    { "oslash", "\xc3\xb8", true },
+    { "DJcy", "\xd0\x82", false },
+    { "nvltrie", "\xe2\x8a\xb4\xe2\x83\x92", false },
+    { "EqualTilde", "\xe2\x89\x82", false },
+    { "subsim", "\xe2\xab\x87", false },
+    { "numero", "\xe2\x84\x96", false },
+    { "ntriangleleft", "\xe2\x8b\xaa", false },
+    { "doublebarwedge", "\xe2\x8c\x86", false },
+    { "Bcy", "\xd0\x91", false },
+    { "supsup", "\xe2\xab\x96", false },
+    { "scnsim", "\xe2\x8b\xa9", false },
+    { "EmptyVerySmallSquare", "\xe2\x96\xab", false },
+    { "emptyv", "\xe2\x88\x85", false },
+    { "Topf", "\xf0\x9d\x95\x8b", false },
+    { "cularr", "\xe2\x86\xb6", false },
+    { "lrhard", "\xe2\xa5\xad", false },
+    { "LeftArrowRightArrow", "\xe2\x87\x86", false },
+    { "LeftUpVectorBar", "\xe2\xa5\x98", false },
+    { "RightVectorBar", "\xe2\xa5\x93", false },
+    { "Uarr", "\xe2\x86\x9f", false },
+    { "loang", "\xe2\x9f\xac", false },
+    { "boxUL", "\xe2\x95\x9d", false },
+    { "siml", "\xe2\xaa\x9d", false },
+    { "diamond", "\xe2\x8b\x84", false },
+    { "vartheta", "\xcf\x91", false },
+    { "rfisht", "\xe2\xa5\xbd", false },
+    { "leftrightarrows", "\xe2\x87\x86", false },
+    { "Downarrow", "\xe2\x87\x93", false },
+    { "shortparallel", "\xe2\x88\xa5", false },
+    { "clubs", "\xe2\x99\xa3", false },
+    { "gcy", "\xd0\xb3", false },
+    { "demptyv", "\xe2\xa6\xb1", false },
+    { "ordf", "\xc2\xaa", true },
+    { "nvgt", "\x3e\xe2\x83\x92", false },
+    { "Acirc", "\xc3\x82", true },
+    { "GT", "\x3e", true },
+    { "pound", "\xc2\xa3", true },
+    { "Ycy", "\xd0\xab", false },
+    { "rfr", "\xf0\x9d\x94\xaf", false },
+    { "roplus", "\xe2\xa8\xae", false },
+    { "curren", "\xc2\xa4", true },
+    { "succapprox", "\xe2\xaa\xb8", false },
+    { "Lcedil", "\xc4\xbb", false },
+    { "leftleftarrows", "\xe2\x87\x87", false },
+    { "xi", "\xce\xbe", false },
+    { "CirclePlus", "\xe2\x8a\x95", false },
+    { "target", "\xe2\x8c\x96", false },
+    { "SuchThat", "\xe2\x88\x8b", false },
+    { "nle", "\xe2\x89\xb0", false },
+    { "dtri", "\xe2\x96\xbf", false },
+    { "lceil", "\xe2\x8c\x88", false },
+    { "varsigma", "\xcf\x82", false },
+    { "boxvh", "\xe2\x94\xbc", false },
+    { "blank", "\xe2\x90\xa3", false },
+    { "oplus", "\xe2\x8a\x95", false },
+    { "Oopf", "\xf0\x9d\x95\x86", false },
+    { "Dashv", "\xe2\xab\xa4", false },
+    { "RightTriangle", "\xe2\x8a\xb3", false },
+    { "Backslash", "\xe2\x88\x96", false },
+    { "nis", "\xe2\x8b\xbc", false },
+    { "Hat", "\x5e", false },
+    { "oopf", "\xf0\x9d\x95\xa0", false },
+    { "LeftTriangleEqual", "\xe2\x8a\xb4", false },
+    { "leg", "\xe2\x8b\x9a", false },
+    { "NotExists", "\xe2\x88\x84", false },
+    { "pitchfork", "\xe2\x8b\x94", false },
+    { "wscr", "\xf0\x9d\x93\x8c", false },
+    { "equiv", "\xe2\x89\xa1", false },
+    { "NotGreaterLess", "\xe2\x89\xb9", false },
+    { "dscy", "\xd1\x95", false },
+    { "gscr", "\xe2\x84\x8a", false },
+    { "Vvdash", "\xe2\x8a\xaa", false },
+    { "bsolb", "\xe2\xa7\x85", false },
+    { "Idot", "\xc4\xb0", false },
+    { "otimesas", "\xe2\xa8\xb6", false },
+    { "rarr", "\xe2\x86\x92", false },
+    { "bsemi", "\xe2\x81\x8f", false },
+    { "larrpl", "\xe2\xa4\xb9", false },
+    { "Cap", "\xe2\x8b\x92", false },
+    { "squf", "\xe2\x96\xaa", false },
+    { "Iuml", "\xc3\x8f", true },
+    { "downharpoonright", "\xe2\x87\x82", false },
+    { "wfr", "\xf0\x9d\x94\xb4", false },
+    { "lHar", "\xe2\xa5\xa2", false },
+    { "cirfnint", "\xe2\xa8\x90", false },
+    { "ffilig", "\xef\xac\x83", false },
+    { "cupor", "\xe2\xa9\x85", false },
+    { "subedot", "\xe2\xab\x83", false },
+    { "RightUpVectorBar", "\xe2\xa5\x94", false },
+    { "Cup", "\xe2\x8b\x93", false },
+    { "dcaron", "\xc4\x8f", false },
+    { "rcedil", "\xc5\x97", false },
+    { "uopf", "\xf0\x9d\x95\xa6", false },
+    { "prsim", "\xe2\x89\xbe", false },
+    { "odiv", "\xe2\xa8\xb8", false },
+    { "nrArr", "\xe2\x87\x8f", false },
+    { "rbbrk", "\xe2\x9d\xb3", false },
+    { "lozf", "\xe2\xa7\xab", false },
+    { "rcy", "\xd1\x80", false },
+    { "Prime", "\xe2\x80\xb3", false },
+    { "ropar", "\xe2\xa6\x86", false },
+    { "Rightarrow", "\xe2\x87\x92", false },
+    { "frac23", "\xe2\x85\x94", false },
+    { "ensp", "\xe2\x80\x82", false },
+    { "Jsercy", "\xd0\x88", false },
+    { "Abreve", "\xc4\x82", false },
+    { "xlArr", "\xe2\x9f\xb8", false },
+    { "mho", "\xe2\x84\xa7", false },
+    { "curarr", "\xe2\x86\xb7", false },
+    { "straightphi", "\xcf\x95", false },
+    { "nGt", "\xe2\x89\xab\xe2\x83\x92", false },
+    { "par", "\xe2\x88\xa5", false },
+    { "iscr", "\xf0\x9d\x92\xbe", false },
+    { "Proportion", "\xe2\x88\xb7", false },
+    { "gtrarr", "\xe2\xa5\xb8", false },
+    { "xwedge", "\xe2\x8b\x80", false },
+    { "uhblk", "\xe2\x96\x80", false },
+    { "bottom", "\xe2\x8a\xa5", false },
+    { "frac18", "\xe2\x85\x9b", false },
+    { "setminus", "\xe2\x88\x96", false },
+    { "ngE", "\xe2\x89\xa7\xcc\xb8", false },
+    { "nu", "\xce\xbd", false },
+    { "nvinfin", "\xe2\xa7\x9e", false },
+    { "Gcirc", "\xc4\x9c", false },
+    { "hercon", "\xe2\x8a\xb9", false },
+    { "boxhd", "\xe2\x94\xac", false },
+    { "prod", "\xe2\x88\x8f", false },
+    { "Icirc", "\xc3\x8e", true },
+    { "ngeqq", "\xe2\x89\xa7\xcc\xb8", false },
+    { "nacute", "\xc5\x84", false },
+    { "thkap", "\xe2\x89\x88", false },
+    { "longmapsto", "\xe2\x9f\xbc", false },
+    { "Im", "\xe2\x84\x91", false },
+    { "vzigzag", "\xe2\xa6\x9a", false },
+    { "subE", "\xe2\xab\x85", false },
+    { "upsih", "\xcf\x92", false },
+    { "subset", "\xe2\x8a\x82", false },
+    { "acirc", "\xc3\xa2", true },
+    { "lopar", "\xe2\xa6\x85", false },
+    { "ShortUpArrow", "\xe2\x86\x91", false },
+    { "scpolint", "\xe2\xa8\x93", false },
+    { "gsiml", "\xe2\xaa\x90", false },
+    { "aelig", "\xc3\xa6", true },
+    { "boxHD", "\xe2\x95\xa6", false },
+    { "NotSupersetEqual", "\xe2\x8a\x89", false },
+    { "duarr", "\xe2\x87\xb5", false },
+    { "uuarr", "\xe2\x87\x88", false },
+    { "MinusPlus", "\xe2\x88\x93", false },
+    { "eopf", "\xf0\x9d\x95\x96", false },
+    { "perp", "\xe2\x8a\xa5", false },
+    { "sccue", "\xe2\x89\xbd", false },
+    { "nges", "\xe2\xa9\xbe\xcc\xb8", false },
+    { "LongLeftArrow", "\xe2\x9f\xb5", false },
+    { "Eopf", "\xf0\x9d\x94\xbc", false },
+    { "sol", "\x2f", false },
+    { "ThickSpace", "\xe2\x81\x9f\xe2\x80\x8a", false },
+    { "operp", "\xe2\xa6\xb9", false },
+    { "Ecy", "\xd0\xad", false },
+    { "eqslantless", "\xe2\xaa\x95", false },
+    { "rbrace", "\x7d", false },
+    { "popf", "\xf0\x9d\x95\xa1", false },
+    { "grave", "\x60", false },
+    { "RightCeiling", "\xe2\x8c\x89", false },
+    { "scnE", "\xe2\xaa\xb6", false },
+    { "Hfr", "\xe2\x84\x8c", false },
+    { "boxVr", "\xe2\x95\x9f", false },
+    { "zeta", "\xce\xb6", false },
+    { "rtriltri", "\xe2\xa7\x8e", false },
+    { "gne", "\xe2\xaa\x88", false },
+    { "curvearrowleft", "\xe2\x86\xb6", false },
+    { "esim", "\xe2\x89\x82", false },
+    { "backsimeq", "\xe2\x8b\x8d", false },
+    { "nvHarr", "\xe2\xa4\x84", false },
+    { "cemptyv", "\xe2\xa6\xb2", false },
+    { "measuredangle", "\xe2\x88\xa1", false },
+    { "DD", "\xe2\x85\x85", false },
+    { "nsubset", "\xe2\x8a\x82\xe2\x83\x92", false },
+    { "ratail", "\xe2\xa4\x9a", false },
+    { "Rfr", "\xe2\x84\x9c", false },
+    { "twoheadrightarrow", "\xe2\x86\xa0", false },
+    { "suplarr", "\xe2\xa5\xbb", false },
+    { "RightFloor", "\xe2\x8c\x8b", false },
+    { "CenterDot", "\xc2\xb7", false },
+    { "fork", "\xe2\x8b\x94", false },
+    { "NotCongruent", "\xe2\x89\xa2", false },
+    { "aopf", "\xf0\x9d\x95\x92", false },
+    { "gfr", "\xf0\x9d\x94\xa4", false },
+    { "fnof", "\xc6\x92", false },
+    { "sup1", "\xc2\xb9", true },
+    { "comma", "\x2c", false },
+    { "questeq", "\xe2\x89\x9f", false },
+    { "rightrightarrows", "\xe2\x87\x89", false },
+    { "thinsp", "\xe2\x80\x89", false },
+    { "Sup", "\xe2\x8b\x91", false },
+    { "sdotb", "\xe2\x8a\xa1", false },
+    { "Rrightarrow", "\xe2\x87\x9b", false },
+    { "euro", "\xe2\x82\xac", false },
+    { "forall", "\xe2\x88\x80", false },
+    { "RightArrow", "\xe2\x86\x92", false },
+    { "bumpeq", "\xe2\x89\x8f", false },
+    { "agrave", "\xc3\xa0", true },
+    { "lrm", "\xe2\x80\x8e", false },
+    { "elinters", "\xe2\x8f\xa7", false },
+    { "ufr", "\xf0\x9d\x94\xb2", false },
+    { "xopf", "\xf0\x9d\x95\xa9", false },
+    { "ncy", "\xd0\xbd", false },
+    { "Integral", "\xe2\x88\xab", false },
+    { "DoubleRightTee", "\xe2\x8a\xa8", false },
+    { "hstrok", "\xc4\xa7", false },
+    { "phmmat", "\xe2\x84\xb3", false },
+    { "tau", "\xcf\x84", false },
+    { "dlcorn", "\xe2\x8c\x9e", false },
+    { "zhcy", "\xd0\xb6", false },
+    { "mcomma", "\xe2\xa8\xa9", false },
+    { "icy", "\xd0\xb8", false },
+    { "Superset", "\xe2\x8a\x83", false },
+    { "neArr", "\xe2\x87\x97", false },
+    { "capcup", "\xe2\xa9\x87", false },
+    { "nsce", "\xe2\xaa\xb0\xcc\xb8", false },
+    { "triangleleft", "\xe2\x97\x83", false },
+    { "DownBreve", "\xcc\x91", false },
+    { "nsucceq", "\xe2\xaa\xb0\xcc\xb8", false },
+    { "TripleDot", "\xe2\x83\x9b", false },
+    { "Del", "\xe2\x88\x87", false },
+    { "NotLeftTriangleEqual", "\xe2\x8b\xac", false },
+    { "hybull", "\xe2\x81\x83", false },
+    { "Ucy", "\xd0\xa3", false },
+    { "DoubleLeftArrow", "\xe2\x87\x90", false },
+    { "swnwar", "\xe2\xa4\xaa", false },
+    { "awconint", "\xe2\x88\xb3", false },
+    { "Aring", "\xc3\x85", true },
+    { "simplus", "\xe2\xa8\xa4", false },
+    { "Utilde", "\xc5\xa8", false },
+    { "period", "\x2e", false },
+    { "Afr", "\xf0\x9d\x94\x84", false },
+    { "xcup", "\xe2\x8b\x83", false },
+    { "Yscr", "\xf0\x9d\x92\xb4", false },
+    { "epsilon", "\xce\xb5", false },
+    { "dharr", "\xe2\x87\x82", false },
+    { "angmsdah", "\xe2\xa6\xaf", false },
+    { "rightarrowtail", "\xe2\x86\xa3", false },
+    { "ncup", "\xe2\xa9\x82", false },
+    { "realpart", "\xe2\x84\x9c", false },
+    { "yacy", "\xd1\x8f", false },
+    { "aring", "\xc3\xa5", true },
+    { "plankv", "\xe2\x84\x8f", false },
+    { "conint", "\xe2\x88\xae", false },
+    { "lrcorner", "\xe2\x8c\x9f", false },
+    { "sqsupset", "\xe2\x8a\x90", false },
+    { "subseteqq", "\xe2\xab\x85", false },
+    { "frac16", "\xe2\x85\x99", false },
+    { "lcedil", "\xc4\xbc", false },
+    { "YIcy", "\xd0\x87", false },
+    { "gdot", "\xc4\xa1", false },
+    { "nlE", "\xe2\x89\xa6\xcc\xb8", false },
+    { "ngeqslant", "\xe2\xa9\xbe\xcc\xb8", false },
+    { "primes", "\xe2\x84\x99", false },
+    { "DoubleDownArrow", "\xe2\x87\x93", false },
+    { "angmsdaa", "\xe2\xa6\xa8", false },
+    { "order", "\xe2\x84\xb4", false },
+    { "congdot", "\xe2\xa9\xad", false },
+    { "minusdu", "\xe2\xa8\xaa", false },
+    { "ltquest", "\xe2\xa9\xbb", false },
+    { "CHcy", "\xd0\xa7", false },
+    { "Equilibrium", "\xe2\x87\x8c", false },
+    { "Re", "\xe2\x84\x9c", false },
+    { "Upsilon", "\xce\xa5", false },
+    { "check", "\xe2\x9c\x93", false },
+    { "thorn", "\xc3\xbe", true },
+    { "gsim", "\xe2\x89\xb3", false },
+    { "intcal", "\xe2\x8a\xba", false },
+    { "Jukcy", "\xd0\x84", false },
+    { "hellip", "\xe2\x80\xa6", false },
+    { "quaternions", "\xe2\x84\x8d", false },
+    { "csupe", "\xe2\xab\x92", false },
+    { "zdot", "\xc5\xbc", false },
+    { "Tfr", "\xf0\x9d\x94\x97", false },
+    { "half", "\xc2\xbd", false },
+    { "boxVl", "\xe2\x95\xa2", false },
+    { "VerticalTilde", "\xe2\x89\x80", false },
+    { "Auml", "\xc3\x84", true },
+    { "divideontimes", "\xe2\x8b\x87", false },
+    { "Popf", "\xe2\x84\x99", false },
+    { "wedgeq", "\xe2\x89\x99", false },
+    { "nshortmid", "\xe2\x88\xa4", false },
+    { "simne", "\xe2\x89\x86", false },
+    { "jmath", "\xc8\xb7", false },
+    { "Qscr", "\xf0\x9d\x92\xac", false },
+    { "Uring", "\xc5\xae", false },
+    { "ltri", "\xe2\x97\x83", false },
+    { "Jcy", "\xd0\x99", false },
+    { "lagran", "\xe2\x84\x92", false },
+    { "NotSucceedsSlantEqual", "\xe2\x8b\xa1", false },
+    { "IJlig", "\xc4\xb2", false },
+    { "DownArrow", "\xe2\x86\x93", false },
+    { "gcirc", "\xc4\x9d", false },
+    { "nles", "\xe2\xa9\xbd\xcc\xb8", false },
+    { "hookleftarrow", "\xe2\x86\xa9", false },
+    { "shchcy", "\xd1\x89", false },
+    { "deg", "\xc2\xb0", true },
+    { "isinE", "\xe2\x8b\xb9", false },
+    { "real", "\xe2\x84\x9c", false },
+    { "vArr", "\xe2\x87\x95", false },
+    { "ugrave", "\xc3\xb9", true },
+    { "lne", "\xe2\xaa\x87", false },
+    { "ltrie", "\xe2\x8a\xb4", false },
+    { "emsp13", "\xe2\x80\x84", false },
+    { "Lstrok", "\xc5\x81", false },
+    { "RBarr", "\xe2\xa4\x90", false },
+    { "cirE", "\xe2\xa7\x83", false },
+    { "backepsilon", "\xcf\xb6", false },
+};
+
+// Seed of each hash bucket, or -slot - 1 for buckets with a single name
+int named_entity_displacements[NAMED_ENTITIES_LEN] = {
+    -2124, 1, 0, 1, 1, -2118, 1, -2117, 0, 2, 0, 0, 1, 1, 0, 3,
+    0, 0, 1, 0, 0, -2114, 0, -2111, 3, 0, 5, 0, 1, 0, -2108, 0,
+    -2106, 4, -2105, -2100, 1, 0, 0, 2, 3, 0, -2099, 0, 1, -2096, -2095, -2093,
+    0, 0, 0, 1, 1, 5, -2089, -2085, 0, 0, -2083, -2080, 3, 0, 0, 0,
+    3, -2079, -2078, 0, -2075, 0, -2070, 2, 0, -2066, -2064, 0, 1, 1, 0, 1,
+    -2056, 0, -2054, 1, 0, 0, 0, 1, 0, -2048, 2, 1, 3, -2046, 0, 2,
+    0, 2, -2037, 3, 3, -2036, -2035, -2034, -2031, 2, -2030, -2028, -2027, 0, 1, 4,
+    1, 3, 0, -2017, 3, 0, 0, -2005, 1, 0, 0, -2003, -2002, -2001, -1993, -1990,
+    0, 1, -1989, -1988, -1987, 1, -1982, 0, 2, 1, 0, 0, 2, 0, -1979, 1,
+    0, -1976, 0, 0, 0, 1, 0, -1975, 0, 2, 0, -1973, 4, 0, 1, -1971,
+    0, 2, -1969, -1968, 0, -1963, 1, 0, 1, 0, 1, 0, 0, -1961, 3, 0,
+    -1959, 0, 0, -1958, 0, 0, 1, 0, -1957, 1, 1, 2, -1956, 1, 1, 1,
+    -1954, -1949, 0, -1948, 5, -1947, -1945, 0, 0, 0, 2, -1944, 1, 0, -1942, 0,
+    0, -1941, 0, -1939, 0, 2, 2, -1933, 3, -1930, 3, 1, 0, 1, 0, 0,
+    0, -1925, -1923, -1919, 0, 0, 6, -1912, 2, 1, -1911, 0, 0, 2, 4, -1909,
+    -1906, 0, 0, 0, 0, -1905, 0, -1904, -1902, -1901, 1, 1, 1, -1894, 1, 0,
+    0, -1893, -1886, -1879, -1876, -1875, -1874, 0, -1873, -1871, -1866, -1864, -1863, -1861, 0, 0,
+    1, -1859, -1858, 2, 0, 0, 2, 0, 0, -1856, -1847, -1844, -1843, 0, -1842, 0,
+    0, -1840, 1, -1837, 5, 0, 1, 0, -1836, 0, 1, 0, -1824, 0, 0, -1820,
+    1, 1, 1, -1814, -1803, -1802, 2, 2, 0, 0, 9, 2, 0, 1, -1801, 1,
+    0, -1800, 1, 0, 6, 3, 1, -1797, -1795, 1, 0, 0, 1, -1794, -1790, -1787,
+    0, 2, -1786, -1784, 2, -1782, -1781, 5, -1779, -1777, 0, -1776, 0, -1774, 0, 0,
+    -1770, 0, 2, -1768, 1, -1761, 0, 0, 1, -1756, 4, -1754, 0, -1751, 0, -1749,
+    0, 2, 0, 0, 0, -1747, 0, -1745, 0, -1744, -1740, 0, -1733, 1, 3, -1731,
+    -1730, -1726, 1, 2, 2, 0, 2, 5, 0, -1721, -1713, 0, 0, -1712, -1711, 1,
+    -1709, 0, 2, -1707, 0, -1700, -1698, -1696, 0, 0, -1692, 1, 0, -1691, 1, 1,
+    0, -1688, 3, 1, -1683, 1, 0, 0, 0, -1679, 2, -1675, 5, 0, -1670, -1667,
+    -1665, 1, 2, 0, 0, 0, 1, -1664, 0, -1660, -1659, 2, 0, 2, -1656, -1654,
+    -1653, 1, -1652, 0, -1645, 1, 0, -1644, 2, 0, -1640, -1636, 0, 0, 0, 1,
+    -1635, 0, 0, 1, 0, 0, 3, 8, 3, -1633, 0, 0, -1632, 3, 0, 0,
+    1, -1629, -1627, -1621, 0, 1, -1613, -1612, 0, 3, 1, 0, 0, 2, -1609, 0,
+    -1605, 0, 0, 0, 0, 0, 0, 9, -1604, -1603, 0, 0, -1602, 4, -1600, -1594,
+    0, 0, -1593, 0, 0, -1592, 5, 2, -1590, 0, 0, 0, 0, -1589, 11, -1584,
+    0, -1583, -1579, -1577, 0, 0, 2, 1, -1574, -1571, 0, -1570, 0, 0, 1, 0,
+    1, 1, -1567, -1566, 4, 0, 0, -1562, -1561, -1557, 0, 0, -1547, 0, -1546, -1538,
+    3, 3, -1536, -1535, 4, 0, 2, 0, -1526, -1525, -1523, 2, 0, 1, -1519, 0,
+    -1517, -1510, 3, 1, -1507, -1504, 0, 0, -1502, -1498, 5, 4, -1497, 0, 0, 1,
+    -1495, 5, -1492, 1, 1, 0, 0, 1, -1489, 0, 0, 0, 0, 3, -1486, 0,
+    2, 3, -1485, 0, 4, -1481, 0, 0, 0, 0, -1477, -1475, -1469, 0, 2, 0,
+    1, -1468, 1, 2, 0, 0, -1466, -1462, 0, 0, -1461, 0, 1, 0, 0, 2,
+    -1460, 0, 0, 1, 0, 6, 1, 0, -1458, 1, -1446, 0, 0, 0, 0, 1,
+    -1445, 3, 0, -1444, 0, -1442, 1, -1441, 1, 1, 0, -1438, -1436, 2, -1435, 2,
+    2, 1, -1432, 0, 0, 0, 1, -1431, -1428, -1425, 1, 0, 0, 1, -1422, 0,
+    -1421, 2, 0, 2, -1420, 0, 0, 0, 0, -1418, 0, 0, -1417, 2, 0, -1416,
+    -1415, 4, 0, -1408, 1, -1407, -1403, -1402, -1401, 1, 1, 0, -1400, 0, -1398, -1395,
+    -1391, 2, 1, 0, 5, 0, 0, 1, -1390, 1, 0, -1389, 10, -1387, 0, -1383,
+    0, 2, -1381, 1, 1, 0, 0, -1380, -1378, 1, -1377, -1374, 0, -1372, -1371, 1,
+    1, 1, 0, 1, -1369, 0, 3, 0, 2, 0, 0, 0, -1362, 0, 2, -1360,
+    0, 0, -1357, -1355, 0, -1353, -1351, -1349, -1348, 0, -1346, 0, -1344, -1341, 2, -1340,
+    0, 2, -1326, -1325, -1322, 0, 2, -1318, 0, 0, 0, 3, 1, -1316, -1309, 0,
+    7, -1305, 2, 0, 0, 0, -1304, 1, -1303, 4, -1302, 0, 0, -1293, 1, -1292,
+    -1289, -1288, 0, -1286, 0, 2, 2, -1280, 1, -1274, -1265, 0, -1264, -1257, -1256, -1255,
+    -1253, -1250, 0, 0, -1248, 0, 1, 0, 0, 1, 1, 0, -1246, 3, -1245, 3,
+    0, 9, 0, -1244, -1243, -1242, 1, -1236, 0, -1234, 0, -1229, 0, 0, -1227, 2,
+    -1221, -1216, 1, -1213, 1, 0, 0, 0, 1, 4, -1209, 0, 0, 1, 2, -1208,
+    2, -1206, 0, 0, 0, 0, -1201, 0, -1200, 7, -1190, 0, 0, 0, 0, 0,
+    0, 0, -1188, 2, 0, 0, 0, 0, 7, 2, 0, 8, -1187, 3, 3, -1186,
+    -1185, -1183, -1181, 4, 0, 0, 0, -1180, -1173, 1, 0, -1171, 4, -1170, 4, 2,
+    3, -1169, -1164, 1, -1163, -1152, -1150, 0, 0, 0, -1149, -1144, 4, -1141, 0, 2,
+    1, -1137, -1136, 0, 0, -1134, 5, 1, -1131, 0, 1, 0, 0, -1129, -1123, 0,
+    0, 8, 2, -1122, -1120, 0, -1112, 4, 0, 0, -1110, -1109, 1, -1106, 0, -1105,
+    2, 0, 0, 0, -1103, 0, 5, 0, 0, 0, 0, -1097, 0, 1, -1092, -1091,
+    -1089, 0, 0, 12, 1, 2, -1086, 0, 0, -1084, 0, 0, -1082, 0, 0, 7,
+    0, -1080, -1079, 0, 0, -1073, -1071, 2, -1065, 0, -1062, -1058, 0, -1057, -1056, 1,
+    -1051, 2, -1045, 1, 0, -1042, 0, 0, 0, 0, 0, -1036, 0, -1030, -1027, 0,
+    0, -1019, 0, 9, 0, -1017, 0, -1016, 1, 1, 1, -1015, 0, 1, 0, 1,
+    0, 0, 1, 1, -1013, -1010, -1007, -1004, -1000, 1, -997, 1, 4, -996, 0, 4,
+    0, 0, -993, 0, -991, -989, 6, -985, 1, -982, -979, 5, 0, 3, -975, 4,
+    -971, 0, 0, -969, -966, 2, -964, 1, -961, 0, 0, 0, 0, 1, 3, -959,
+    0, 0, -958, 1, -957, 0, 0, 0, -956, 0, 2, -953, 0, 1, 7, -950,
+    0, -949, -947, 1, -942, 9, 0, 0, -939, -931, 7, -928, 0, 1, -927, 1,
+    -923, 2, -922, -920, 0, 0, -919, 0, 1, -917, 1, 16, 9, 0, 2, 0,
+    -915, -914, 0, 0, 0, -909, 0, 0, 0, 0, -908, -903, 0, 1, 3, 2,
+    -900, 5, 1, -895, 0, -894, 0, -893, -892, 6, 1, -889, -887, 0, 0, 0,
+    0, -883, -882, 0, 0, 0, 0, 1, -881, -879, 0, -878, 0, 0, 0, -873,
+    -871, 18, 1, 0, 3, -869, -867, 0, -866, -865, 0, 1, 0, 0, 14, 6,
+    -864, 0, 0, -863, 0, 0, 0, 0, -860, -858, 0, -857, -856, 0, -851, 7,
+    -845, 0, -840, -839, -836, 0, 1, 0, 1, 0, 0, 0, 0, 1, -835, 2,
+    0, 11, -833, 0, 0, -826, 1, 5, -825, 0, 0, 7, -821, 0, -818, 1,
+    0, 2, 5, 1, 0, -817, 0, 0, 0, -815, -814, 1, 1, 25, 0, 15,
+    10, 11, -809, 0, 0, -807, 1, 1, -802, -801, -798, -795, 1, -784, 0, 0,
+    -780, 1, 3, 1, -779, 0, -775, 3, -771, 0, 0, -769, 5, 3, -768, -766,
+    4, 1, 0, -765, 0, -764, -762, 0, -761, 6, 0, -758, -757, -751, 0, 3,
+    0, -749, 0, 12, 0, 0, 3, -747, -745, 1, -744, 0, -743, 0, 0, 2,
+    -740, -734, 1, 1, 5, 0, 0, 0, 2, -733, 5, -731, 0, 1, 1, -730,
+    0, 0, 21, -729, -727, -724, 0, -723, 2, 0, 0, 1, 0, -719, -718, 0,
+    0, -715, 0, 0, 0, 13, -714, -711, -710, 0, -709, 1, -702, -698, 7, -694,
+    0, -693, 1, 0, 0, -692, -683, 0, 1, 3, -682, 0, 0, 0, 2, -681,
+    -676, 0, -669, -668, 0, -665, 0, 1, -664, -662, 6, 3, 26, 0, -660, 1,
+    -659, 0, 0, 0, 0, 7, 0, 0, 0, -654, -653, 1, 1, 8, 0, -651,
+    -649, 0, -647, 0, 0, 1, 0, 0, -645, 0, 1, 0, 0, -643, -642, 5,
+    -639, -636, 1, 0, 0, 0, 6, -632, 0, 0, 0, 0, -630, -628, -626, -623,
+    -620, -615, 0, -614, 29, -613, 0, 6, 1, -611, 0, -609, -608, -603, 0, 1,
+    -602, -596, 4, 2, 1, 15, 0, -593, -589, 0, 0, 0, 0, 1, 0, -587,
+    -582, -581, -580, 0, 0, 0, -576, 1, 0, 0, 0, 0, -573, -570, -565, -564,
+    -558, 0, 0, 0, -552, -544, 0, -543, 0, 5, -540, -539, -538, -536, 0, -535,
+    0, 0, 0, -533, -530, -526, 12, 0, 0, -525, -523, 1, -520, 0, 6, 2,
+    2, 0, -519, 0, -518, -509, -508, 1, 4, 0, 6, 1, -501, 0, 1, 1,
+    4, 1, 0, 0, 0, 5, -499, 0, 0, 0, -491, -490, 0, -487, -484, -483,
+    -481, 1, 0, -480, -477, -475, 6, 0, -473, 0, 0, -471, 0, -470, 0, 0,
+    -461, 0, -458, 1, 1, 0, -457, -453, -448, 0, -446, 0, 9, -444, 20, -443,
+    0, -442, -437, 1, -436, -435, -432, 0, 10, -429, -427, 0, -423, -422, 0, 0,
+    0, 0, 0, 0, -420, 1, 4, 20, -416, 0, 9, -415, 0, 0, 13, 0,
+    2, 3, 0, 5, 3, -414, 0, 0, 0, -413, 0, 2, 0, 0, 1, -410,
+    9, 0, 0, 0, 0, 3, 2, -404, 2, 13, -402, 0, 0, 6, -399, 0,
+    -398, -395, -391, 10, 0, -390, 0, 0, 0, -385, 2, 1, 0, -384, 2, -383,
+    4, -382, -380, -369, -366, -363, 0, -358, -355, 0, 0, 9, 3, -353, 1, -350,
+    4, 2, -348, 0, -341, 1, 0, 0, 0, 0, -340, 0, 0, 0, 0, -339,
+    0, -338, 0, -336, 1, -335, -333, 0, 2, 1, 0, 0, 0, -329, -327, 0,
+    0, 1, -323, 0, -322, 7, 1, -321, -320, -319, 5, 0, 1, 0, 7, 8,
+    19, 0, 3, 0, -317, -314, 0, 0, -312, -310, 1, 0, -308, 0, 2, 4,
+    1, -304, 0, 8, -300, 5, -297, -296, 1, 2, 0, 0, 7, -292, 0, 14,
+    5, 0, 0, 0, -288, 0, 0, 1, 0, 0, 0, -284, 3, -281, -279, 0,
+    0, 0, 1, 2, 3, -277, 0, 0, -276, -269, -264, -263, 7, 1, 12, 0,
+    0, 1, 35, 0, 0, 0, 0, 4, -262, 0, 0, -257, -256, 0, -253, 0,
+    -247, -245, 3, -243, 1, 0, 0, 0, 0, 2, 2, -239, 1, -234, 0, 0,
+    -233, 0, -230, 3, -227, -222, 0, 5, -220, 0, 0, 0, -219, 0, -218, 0,
+    4, 0, 0, 4, 0, 1, 0, 3, 0, -212, 3, 5, 8, -209, -206, 0,
+    -205, 0, -201, -197, -196, 0, -189, 0, 0, 0, -188, -184, -182, 3, 0, -181,
+    0, 0, -180, 0, 7, 1, 0, -178, 0, 0, 0, 0, 46, 0, 1, 0,
+    -177, -174, 0, 0, -172, 1, -169, 0, 0, 5, 2, 10, 2, 0, 0, -168,
+    1, 0, -163, -162, 6, 0, 0, 0, -157, 1, 1, 0, -156, 0, -155, 8,
+    0, -154, -149, 0, 0, -148, 0, 14, -142, 2, -141, 0, 51, 6, 3, 0,
+    12, 7, 2, -140, 0, 2, 0, 0, 0, 3, 0, 0, -139, 0, 9, -137,
+    -132, 0, 0, 0, 4, 1, -131, -130, -128, -127, -126, 0, 0, 0, 0, 9,
+    12, -125, 0, 6, 0, 0, 0, 0, 0, 0, 12, 0, 9, -122, 1, 2,
+    0, -119, 1, 0, 0, 0, 2, 0, -112, 14, 0, -111, 0, 0, 21, -106,
+    -105, -101, -96, -95, -92, 0, 0, 0, 0, 3, -90, 0, -85, -84, 0, -80,
+    -78, -71, 1, 1, -68, -67, 0, 0, -66, 0, 0, -64, -63, -60, 67, 14,
+    0, 0, 1, 0, 2, 0, 2, 0, 0, -57, -53, 7, 13, 2, 0, 0,
+    -49, 0, 0, 0, 0, 0, 1, 0, -46, 0, -39, -38, 1, 0, -34, -33,
+    0, -31, 0, 1, 0, -29, -28, -27, 0, -26, 0, -23, 0, 0, 6, -17,
+    0, 0, -15, 0, 7, -13, -12, -11, -7, -5, 0, -1, 0,
+};
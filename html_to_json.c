@@ -1,5 +1,7 @@
+#define _GNU_SOURCE // memmem
 #include <json-c/json_object.h>
 #include <json-c/json_util.h>
+#include <json-c/printbuf.h>
 #include <stdlib.h>
 #include <stdio.h>
 #include <stddef.h>
@@ -7,11 +9,48 @@
 #include <stdbool.h>
 #include <string.h>
 #include <ctype.h>
+#include <strings.h>
+#include <stdint.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <tmmintrin.h>
+#define HAVE_SSSE3_DISPATCH // SSSE3 code is compiled with a target attribute and picked at runtime
+#endif
 #include <json-c/json.h>
+#include <pthread.h>
+#include <signal.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <zlib.h>
+#ifdef HAVE_ZSTD
+#include <zstd.h>
+#endif
+#include <arpa/inet.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <sys/epoll.h>
+#include <sys/un.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <stdatomic.h>
+#ifdef HAVE_LIBURING
+#include <liburing.h>
+#endif
+
+// Tokenizer and tree tracing, off unless built with -DHTML_TRACE (it's a line per token, too much for batches)
+#ifdef HTML_TRACE
+#define trace(...) printf(__VA_ARGS__)
+#else
+#define trace(...) ((void) 0)
+#endif
 
 typedef struct Attribute {
-    char *name;
-    char *value;
+    const char *name; // interned, see intern_string()
+    const char *value; // interned for the names in interned_value_attributes, otherwise owned by the attribute
+    bool value_interned;
 } Attribute;
 
 typedef struct HTMLTag {
@@ -22,8 +61,205 @@ typedef struct HTMLTag {
     struct HTMLTag **children; // array of pointers to nested tags
     int children_length;
     int attribute_length;
+    uint64_t hash; // hash of the whole subtree, set once the element is closed
+    int subtree_size; // number of tags in the subtree, set along with hash
 } HTMLTag;
 
+// When to stop parsing before the end of the input, unset (0 or NULL) limits don't apply
+typedef struct StopCondition {
+    size_t max_bytes; // stop once this much input has been parsed
+    int max_nodes; // stop once this many tags are in the tree
+    const char *close_tag; // stop once an element with this name has closed
+    const char *match_tag; // stop once match_count elements with this name have closed
+    int match_count;
+
+    // Filled in by parse_tags_until()
+    bool stopped;
+    size_t bytes_parsed;
+    int nodes_length;
+    int matches_length;
+} StopCondition;
+
+typedef struct SubtreeStore {
+    uint64_t *hashes; // open addressing, 0 marks an empty slot
+    json_object **subtrees; // NULL while a subtree has only been seen once
+    int size;
+    int length; // hashes seen
+    int stored; // subtrees held, i.e. seen at least twice
+    int references; // subtrees replaced by a reference while serializing
+    int collisions; // hash matches whose subtree turned out to differ, serialized inline instead
+    pthread_mutex_t lock;
+} SubtreeStore;
+
+// Connections with a request waiting to be read, in the order they became readable
+typedef struct ServerQueue {
+    int *fds; // ring buffer
+    int head;
+    int length;
+    int size;
+    pthread_mutex_t lock;
+    pthread_cond_t not_empty;
+} ServerQueue;
+
+typedef struct ServerWorker {
+    int epoll_fd; // connections are re-armed here after each request
+    ServerQueue *queue;
+    char *buf; // request buffer, reused across requests handled by this worker
+    size_t bufsize;
+} ServerWorker;
+
+// Interned attribute names and values of one session (a document, a server request or a batch/WARC worker)
+// A table belongs to a single thread, so lookups take no lock
+typedef struct InternTable {
+    const char **strings; // open addressing, NULL marks an empty slot
+    uint64_t *hashes;
+    int size;
+    int length;
+    char *arena; // current chunk the strings are copied into
+    size_t arena_used;
+    size_t arena_size;
+    char **chunks; // every arena chunk, freed with the table
+    int chunks_length;
+    int chunks_size;
+    size_t bytes_stored;
+    size_t lookups;
+    size_t bytes_requested;
+} InternTable;
+
+// Interning counters of one or more tables, see intern_stats_add()
+typedef struct InternStats {
+    size_t lookups;
+    size_t bytes_requested;
+    size_t bytes_stored;
+    int distinct; // summed over the tables, a string used by two workers counts twice
+} InternStats;
+
+typedef struct Decompressor {
+    FILE *source; // compressed input
+    int fd; // write end of the pipe the tokenizer reads from
+    char *format; // "gzip" or "zstd"
+    pthread_t thread; // joined by close_file()
+    bool ok; // set by the thread before it exits
+} Decompressor;
+
+typedef struct WarcRecord {
+    const char *id; // WARC-Record-ID, points into the mapped file
+    size_t id_length;
+    const char *uri; // WARC-Target-URI, points into the mapped file
+    size_t uri_length;
+    const char *body; // HTML body of the HTTP response, a zero-copy slice of the mapped file
+    size_t body_length;
+    bool chunked; // body is sent with Transfer-Encoding: chunked and is decoded before parsing
+    char *output; // JSON line, set once the record is parsed
+    size_t output_length;
+    bool failed; // output is an error line
+    bool done;
+} WarcRecord;
+
+typedef struct WarcJob {
+    WarcRecord *records;
+    int records_length;
+    int next_record; // index of the next record to hand out to a worker
+    InternStats interned; // every worker has its own table and adds its counters when it exits
+    pthread_mutex_t lock;
+    pthread_cond_t record_done;
+} WarcJob;
+
+typedef struct BatchFile {
+    char *input_filename;
+    char *output_filename;
+    char *data; // file contents
+    size_t size;
+    char *output; // serialized JSON
+    size_t output_length;
+    int fd; // used by the io_uring backend while a read or write is in flight
+    struct BatchFile *next; // next file in the queue it's in
+} BatchFile;
+
+typedef struct BatchQueue {
+    BatchFile *head;
+    BatchFile *tail;
+} BatchQueue;
+
+typedef struct BatchJob {
+    BatchFile *files;
+    int files_length;
+    int next_read; // index of the next file to read
+    int reads_in_flight;
+    int in_memory; // files read but not written yet, at most BATCH_QUEUE_DEPTH
+    int finished; // files written or failed
+    int failed;
+    BatchQueue parse_queue;
+    BatchQueue write_queue;
+    pthread_mutex_t lock;
+    pthread_cond_t changed;
+
+    // Statistics, in seconds summed over threads
+    double io_seconds; // spent in blocking reads/writes or waiting for io_uring completions
+    double parse_seconds; // spent parsing and serializing
+    double parse_wait_seconds; // parsers idle, waiting for input to be read
+    size_t bytes_read;
+    size_t bytes_written;
+
+    SubtreeStore *store; // shared across parsers when deduplicating, otherwise NULL
+    InternStats interned; // every parser has its own table and adds its counters when it exits
+} BatchJob;
+
+// Consecutive sibling subtrees serialized on their own by a worker, spliced into the document through a placeholder
+typedef struct SerializeTask {
+    HTMLTag **tags; // points into the parent's children
+    int tags_length;
+    json_object *placeholder;
+    char *rendered; // serialized at level 0
+} SerializeTask;
+
+typedef struct SerializeJob {
+    SerializeTask *tasks;
+    int tasks_length;
+    int tasks_size;
+    atomic_int next_task;
+    int flags;
+} SerializeJob;
+
+// Per-document state of normalize_line()
+typedef struct LineDecoder {
+    bool first_line;
+    bool windows_1252;
+    bool charset_known; // set by a BOM, a <meta> charset or <body>, no declarations are looked for after that
+} LineDecoder;
+
+typedef enum TextState {
+    TEXT_STATE_TEXT,
+    TEXT_STATE_TAG,
+    TEXT_STATE_COMMENT,
+    TEXT_STATE_RAW_TEXT, // contents of <script> and <style>
+} TextState;
+
+typedef struct TextExtractor {
+    FILE *out;
+    TextState state;
+    char tag_name[16]; // lowercased, truncated
+    int tag_name_length;
+    bool tag_name_done;
+    bool tag_closing;
+    char quote; // quote character while inside a quoted attribute value, otherwise 0
+    char *raw_text_end; // "</script" or "</style" while in raw text
+    bool boundaries; // separate block elements with newlines instead of spaces
+    char pending; // separator to write before the next text: 0, ' ' or '\n'
+    bool at_start;
+    char *scratch; // collapsed text of the current run
+    size_t scratch_size;
+    char *decoded; // scratch with character references decoded
+    size_t decoded_size;
+    size_t bytes_out;
+} TextExtractor;
+
+typedef struct Entity {
+    char *name; // without the semicolon
+    char *value; // UTF-8 encoded replacement text
+    bool legacy; // also matches without the semicolon, e.g. &copy
+} Entity;
+
 char *valid_tags[] = {
     "body",
     "form",
@@ -42,25 +278,98 @@ char *valid_tags[] = {
     "ul",
     "ol",
     "li",
+    "html",
+    "head",
+    "title",
+    "meta",
+    "link",
+};
+
+// Tags that separate text (by a newline with --boundaries, otherwise a space), sorted for binary search
+char *block_tags[] = {
+    "address", "article", "aside", "blockquote", "body", "br", "dd", "div", "dl", "dt",
+    "fieldset", "figcaption", "figure", "footer", "form", "h1", "h2", "h3", "h4", "h5", "h6",
+    "head", "header", "hr", "html", "li", "main", "nav", "ol", "p", "pre", "section",
+    "table", "td", "th", "title", "tr", "ul",
+};
+
+// ASCII whitespace, which collapses into a single space in extracted text
+bool text_whitespace_chars[256] = {
+    [' '] = true, ['\n'] = true, ['\t'] = true, ['\r'] = true, ['\f'] = true,
+};
+
+// Attributes whose values repeat across tags and pages (utility classes, rel="stylesheet"), so they are interned too
+// Values of the others (href, src, id, ...) are mostly unique and are freed with their tag
+char *interned_value_attributes[] = {
+    "class",
+    "rel",
+    "type",
+    "role",
+    "target",
+    "lang",
+    "dir",
 };
 
 char *non_closing_tags[] = {
     "br",
     "img",
     "input",
+    "meta",
+    "link",
 };
 
+// Unicode code points of Windows-1252 bytes 0x80-0x9F, the rest match Latin-1
+unsigned short windows_1252_c1[] = {
+    0x20AC, 0x0081, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021,
+    0x02C6, 0x2030, 0x0160, 0x2039, 0x0152, 0x008D, 0x017D, 0x008F,
+    0x0090, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014,
+    0x02DC, 0x2122, 0x0161, 0x203A, 0x0153, 0x009D, 0x017E, 0x0178,
+};
+
+// Named character references: the full WHATWG table, looked up through a perfect hash
+#include "html_entities.h"
+
 #define NON_CLOSING_TAGS_LEN (int) (sizeof(non_closing_tags) / sizeof(char*))
 #define VALID_TAGS_LEN (int) (sizeof(valid_tags) / sizeof(char*))
+#define BLOCK_TAGS_LEN (int) (sizeof(block_tags) / sizeof(char*))
+#define INTERNED_VALUE_ATTRIBUTES_LEN (int) (sizeof(interned_value_attributes) / sizeof(char*))
+#define TEXT_OUTPUT_BUFFER_SIZE (1024 * 1024)
+#define TAG_BUFFER_INITIAL_SIZE 128 // tag and attribute names and values, grown as needed
+#define TAG_CONTENT_INITIAL_SIZE 1024 // text preceding a tag, grown as needed
+#define MAX_ENTITY_NAME_LEN 32
+#define MAX_LEGACY_ENTITY_NAME_LEN 6 // longest name that may be used without the semicolon
+#define MAX_DECODED_LENGTH(length) ((length) + (length) / 5 + 1) // &nGt; and &nLt; decode to 6 bytes, every other reference shrinks
+#define JSON_OUTPUT_FLAGS JSON_C_TO_STRING_PRETTY
+#define SERVER_DEFAULT_WORKERS 4
+#define SERVER_MAX_PAYLOAD (64 * 1024 * 1024)
+#define SERVER_READ_TIMEOUT 10 // seconds a worker waits for the rest of a request before dropping the connection
+#define SERVER_MAX_EVENTS 64
+#define DECOMPRESS_CHUNK_SIZE (128 * 1024)
+#define DECOMPRESS_PIPE_SIZE (1024 * 1024)
+#define WARC_DEFAULT_WORKERS 4
+#define BATCH_DEFAULT_WORKERS 4
+#define BATCH_IO_THREADS 4
+#define BATCH_QUEUE_DEPTH 32 // files read ahead of the parsers (and held in memory) at most
+#define SERIALIZE_MIN_NODES 4096 // smaller trees are serialized sequentially
+#define SERIALIZE_TASKS_PER_WORKER 8 // more, smaller tasks balance uneven subtrees
+#define SERIALIZE_BENCHMARK_RUNS 3
+#define INTERN_TABLE_INITIAL_SIZE 1024 // must be a power of two
+#define INTERN_ARENA_CHUNK_SIZE (64 * 1024)
+#define DEDUP_MIN_NODES 4 // smaller subtrees aren't worth a reference
+#define DEDUP_STORE_INITIAL_SIZE 1024 // must be a power of two
+#define FNV_OFFSET_BASIS 0xcbf29ce484222325ULL
+#define FNV_PRIME 0x100000001b3ULL
 #define VALID_ATTR_SPECIAL_CHARS "%?!#$%&'=()*+,-./:;[] "
 
 /* Flags */
-bool COMMENT_OPENED = false;
+// Thread-local so that server workers can tokenize documents concurrently
+_Thread_local bool COMMENT_OPENED = false;
 
 /* Utilities */
 size_t strlength(const char *str);
 char *remove_chr(char *str, int c);
 bool str_in_arr(char *str, char *arr[], int arr_len);
+int compare_strings(const void *a, const void *b);
 bool char_in(const char *str, int c);
 bool strequals(const char *str1, const char *str2);
 bool is_valid_tag(HTMLTag *tag);
@@ -69,25 +378,145 @@ bool is_closing_tag(HTMLTag *tag);
 bool open_close_tags_match(char *open_tag, char *close_tag);
 void print_all_tags(HTMLTag *root, int padding);
 char *get_tag_type(HTMLTag *tag);
+double now();
+
+/* Entities */
+uint32_t entity_hash(uint32_t seed, const char *name, size_t name_length);
+const Entity *lookup_entity(const char *name, size_t name_length);
+int encode_utf8(unsigned long codepoint, char *out);
+size_t decode_reference(const char *ref, char *out, int *written, bool in_attribute);
+const char *decode_entities(const char *str, bool in_attribute);
+size_t decode_entities_into(const char *str, size_t length, char *out, bool in_attribute);
+
+/* Encoding */
+size_t ascii_prefix_length(const char *str, size_t length);
+int utf8_sequence_length(const unsigned char *s, const unsigned char *end);
+#ifdef HAVE_SSSE3_DISPATCH
+size_t validate_utf8_ssse3(const unsigned char *s, size_t length);
+#endif
+size_t validate_utf8(const char *str, size_t length);
+char *replace_invalid_utf8(const char *str, size_t length, int *replaced);
+char *charset_for_label(const char *label, size_t label_length);
+char *detect_charset(const char *str, const char *end);
+char *transcode_windows_1252(const char *str, size_t length);
+char *normalize_line(char *line, size_t *length_ptr, LineDecoder *decoder);
 
 /* I/O */
-FILE *open_file();
+FILE *open_file(const char *fname, Decompressor **decompressor);
+bool close_file(FILE *stream, Decompressor *decompressor);
+char *detect_compression(const unsigned char *magic, size_t length);
+FILE *open_decompressed(FILE *source, char *format, Decompressor **decompressor);
+void *decompress_to_pipe(void *arg);
+bool write_chunk(int fd, const void *buf, size_t length);
+bool decompress_gzip(FILE *source, int fd);
+bool decompress_zstd(FILE *source, int fd);
 char *readline(FILE *fp);
 
 /* HTMLTag/Attribute */
-Attribute *create_attribute(const char *name, const char *value);
+Attribute *create_attribute(InternTable *table, const char *name, const char *value);
 HTMLTag *create_tag_from_string(const char *name, const char *content);
-HTMLTag *next_tag(char **line_ptr);
+HTMLTag *next_tag(char **line_ptr, InternTable *table, const char **error);
 
 /* Adding HTMLTags/Attributes */
 void add_child(HTMLTag *parent, HTMLTag *child);
 void add_attribute(HTMLTag *tag, Attribute *attr);
-HTMLTag *parse_tags(FILE *stream);
+void append_char(char **buf, size_t *size, int *offset, int chr);
+HTMLTag *parse_tags(FILE *stream, InternTable *table, const char **error);
+HTMLTag *parse_tags_until(FILE *stream, StopCondition *stop, InternTable *table, const char **error);
+void free_open_tags(HTMLTag *current_tag);
+bool stop_condition_met(StopCondition *stop, HTMLTag *completed_tag);
+
+/* Interning */
+int intern_find(InternTable *table, const char *str, size_t length, uint64_t hash);
+void intern_grow(InternTable *table);
+const char *intern_arena_copy(InternTable *table, const char *str, size_t length);
+const char *intern_string(InternTable *table, const char *str);
+void intern_table_init(InternTable *table);
+void intern_table_free(InternTable *table);
+void intern_stats_add(InternStats *stats, InternTable *table);
+void print_intern_report(InternStats *stats, const char *indent);
+
+/* Hashing */
+uint64_t hash_bytes(uint64_t hash, const void *data, size_t length);
+uint64_t hash_string(uint64_t hash, const char *str);
+uint64_t hash_tag(HTMLTag *tag);
+
+/* Diff */
+char *child_path(const char *path, int index);
+json_object *json_create_edit(const char *op, const char *path);
+void diff_attributes(HTMLTag *old_tag, HTMLTag *new_tag, const char *path, json_object *edits);
+void diff_children(HTMLTag *old_tag, HTMLTag *new_tag, const char *path, json_object *edits);
+void diff_tags(HTMLTag *old_tag, HTMLTag *new_tag, const char *path, json_object *edits);
+int diff_files(const char *old_filename, const char *new_filename, const char *json_filename);
+
+/* Deduplication */
+void subtree_id(uint64_t hash, char *id);
+int subtree_store_find(SubtreeStore *store, uint64_t hash);
+int subtree_store_insert(SubtreeStore *store, uint64_t hash);
+SubtreeStore *subtree_store_load(const char *store_filename);
+bool subtree_store_save(SubtreeStore *store, const char *store_filename);
+void subtree_store_free(SubtreeStore *store);
+json_object *subtree_store_get(SubtreeStore *store, uint64_t hash);
+bool json_string_equals(json_object *json_str, const char *str);
+bool subtree_matches(HTMLTag *tag, json_object *json_tag, SubtreeStore *store);
+json_object *json_create_subtree_reference(SubtreeStore *store, uint64_t hash);
+json_object *json_create_deduplicated_subtree(HTMLTag *tag, SubtreeStore *store);
+void expand_references(json_object *tags, SubtreeStore *store);
+int expand_file(const char *store_filename, const char *json_filename, const char *output_filename);
+
+/* Text extraction */
+void text_emit_run(TextExtractor *ex, const char *start, const char *end);
+void text_end_tag(TextExtractor *ex);
+void text_extract_line(TextExtractor *ex, char *line, size_t length);
+int extract_text(const char *html_filename, const char *text_filename, bool boundaries);
 
 /* JSON */
 json_object *json_create_attributes_array(Attribute **attrs, int attrs_length);
 json_object *json_create_tag(HTMLTag *tag);
 void json_traverse_children_and_create_tags(HTMLTag *root, json_object *json_root, json_object *root_children);
+json_object *json_create_subtree(HTMLTag *root);
+json_object *json_create_document(HTMLTag *root);
+int json_serialize_rendered(json_object *jso, struct printbuf *pb, int level, int flags);
+json_object *json_partition_subtree(HTMLTag *tag, int max_task_nodes, SerializeJob *job);
+void *serialize_worker(void *arg);
+json_object *json_create_document_parallel(HTMLTag *root, int workers_length, int flags);
+int benchmark_serialization(const char *html_filename, int max_workers);
+
+/* WARC */
+const char *find_header(const char *headers, const char *end, const char *name, size_t *value_length);
+size_t parse_length(const char *str, size_t length);
+ssize_t dechunk_body(const char *body, size_t length, char *out);
+int index_warc_records(const char *data, size_t size, WarcRecord **records_ptr);
+void parse_warc_record(WarcRecord *record, InternTable *table);
+void *warc_worker(void *arg);
+int convert_warc(const char *warc_filename, const char *json_filename, int workers_length);
+
+/* Batch */
+void batch_queue_push(BatchQueue *queue, BatchFile *file);
+BatchFile *batch_queue_pop(BatchQueue *queue);
+char *batch_output_filename(const char *input_filename);
+bool batch_read_file(BatchFile *file);
+bool batch_write_file(BatchFile *file);
+bool batch_parse_file(BatchFile *file, SubtreeStore *store, InternTable *table);
+void batch_file_read(BatchJob *job, BatchFile *file, bool ok);
+void batch_file_written(BatchJob *job, BatchFile *file, bool ok);
+void *batch_parse_worker(void *arg);
+void *batch_io_worker(void *arg);
+#ifdef HAVE_LIBURING
+void *batch_uring_worker(void *arg);
+#endif
+int convert_batch(char **filenames, int files_length, char *backend, int workers_length, char *store_filename);
+
+/* Server */
+bool read_exact(int fd, void *buf, size_t length);
+bool writev_exact(int fd, struct iovec *iov, int iov_length);
+void server_queue_push(ServerQueue *queue, int fd);
+int server_queue_pop(ServerQueue *queue);
+bool send_response(int fd, json_object *response);
+bool handle_request(ServerWorker *worker, int fd, size_t length);
+bool serve_request(ServerWorker *worker, int fd);
+void *server_worker(void *arg);
+int serve(const char *socket_path, int workers_length);
 
 /*
  * Returns the length of a given string
@@ -176,6 +605,13 @@ bool open_close_tags_match(char *open_tag, char *close_tag) {
     return match;
 }
 
+/*
+ * Compares two strings through pointers to them, for qsort() and bsearch() over arrays of strings
+ */
+int compare_strings(const void *a, const void *b) {
+    return strcmp(*(char* const*) a, *(char* const*) b);
+}
+
 /*
  * Checks whether a given character is present in str or not
  */
@@ -235,7 +671,7 @@ bool str_in_arr(char *str, char *arr[], int arr_len) {
  * Makes sure the tag is valid and returns whether it's a closing or an opening one 
  * E.g. <span> => "opening"
  *      </p> => "closing"
- *      <sp/oon> => Invalid tag error
+ *      <sp/oon> => "invalid"
  */
 char *get_tag_type(HTMLTag *tag) {
     if (is_valid_tag(tag)) {
@@ -251,10 +687,19 @@ char *get_tag_type(HTMLTag *tag) {
     }
     else {
         printf("Got invalid tag: %s\n", tag->name);
-        exit(1);
+        return "invalid";
     }
 }
 
+/*
+ * Returns monotonic time in seconds
+ */
+double now() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
 /*
  * Prints all parsed tags with padding
  */
@@ -281,7 +726,7 @@ void print_all_tags(HTMLTag *root, int padding) {
  * Frees memory of a given HTMLTag and all its children
  */
 void free_tag(HTMLTag *root) {
-    printf("Freeing <%s>\n", root->name);
+    trace("Freeing <%s>\n", root->name);
 
     // Free children tags
     for (int i = 0; i < root->children_length; i++) {
@@ -291,9 +736,10 @@ void free_tag(HTMLTag *root) {
 
     // Free attributes
     for (int i = 0; i < root->attribute_length; i++) {
+        // The name (and a repeating value) is interned and lives as long as the session
         Attribute *attr = *(root->attributes + i);
-        free(attr->name);
-        free(attr->value);
+        if (!attr->value_interned)
+            free((char*) attr->value);
         free(attr);
     }
 
@@ -317,225 +763,1117 @@ void free_tag(HTMLTag *root) {
     free(root);
 }
 
-/* 
- * Opens a file stream and returns a pointer to it
+/*
+ * 32-bit FNV-1a of an entity name, the seed replaces the offset basis (0 keeps it)
+ * Has to match entity_hash() in gen_entities.py
  */
-FILE *open_file() {
-    FILE *fptr;
-    const char *fname = "index.html";
+uint32_t entity_hash(uint32_t seed, const char *name, size_t name_length) {
+    uint32_t hash = seed ? seed : 0x811C9DC5;
 
-    fptr = fopen(fname, "r");
-    if (!fptr) {
-        perror("File opening failed");
-        return NULL;
+    for (size_t i = 0; i < name_length; i++) {
+        hash ^= (unsigned char) name[i];
+        hash *= 0x01000193;
     }
 
-    return fptr;
+    return hash;
 }
 
-/* 
- * Reads a line from file stream
+/*
+ * Looks up a named character reference (without '&' and ';') and returns its entry
+ * Returns NULL if the name is unknown
+ * The perfect hash gives the only slot the name can be in, so a lookup is two hashes and one comparison
+ * E.g. lookup_entity("amp", 3)->value => "&"
  */
-char *readline(FILE *fp) {
-    int offset = 0;
-    int bufsize = 4;
-    char *buf = (char*) calloc(bufsize, sizeof(char));
-    int c;
+const Entity *lookup_entity(const char *name, size_t name_length) {
+    if (name_length == 0 || name_length > MAX_ENTITY_NAME_LEN)
+        return NULL;
 
-    if (buf == NULL) {
-        perror("Failed to allocate memory for the buffer");
+    int displacement = named_entity_displacements[entity_hash(0, name, name_length) % NAMED_ENTITIES_LEN];
+    int slot = displacement < 0 ? -displacement - 1 : (int) (entity_hash(displacement, name, name_length) % NAMED_ENTITIES_LEN);
+    const Entity *entity = &named_entities[slot];
+
+    if (strncmp(entity->name, name, name_length) != 0 || entity->name[name_length] != '\0')
         return NULL;
-    }
 
-    // Right-most expression in while-loop must be the condition
-    while(c = fgetc(fp), c != EOF) {
-        if (offset == bufsize - 1) { // -1 for the NULL terminator
-            bufsize *= 2;
+    return entity;
+}
 
-            char *new_buf = realloc(buf, bufsize);
-            if (new_buf == NULL) {
-                perror("Failed to reallocate memory for the buffer");
-                return NULL;
-            }
+/*
+ * Writes the UTF-8 encoding of a code point to out and returns the number of bytes written
+ * Invalid code points (NUL, surrogates, out of range) are replaced with U+FFFD
+ */
+int encode_utf8(unsigned long codepoint, char *out) {
+    unsigned char *o = (unsigned char*) out;
 
-            buf = new_buf;
+    if (codepoint == 0 || codepoint > 0x10FFFF || (codepoint >= 0xD800 && codepoint <= 0xDFFF))
+        codepoint = 0xFFFD;
+
+    if (codepoint < 0x80) {
+        o[0] = codepoint;
+        return 1;
+    }
+    if (codepoint < 0x800) {
+        o[0] = 0xC0 | (codepoint >> 6);
+        o[1] = 0x80 | (codepoint & 0x3F);
+        return 2;
+    }
+    if (codepoint < 0x10000) {
+        o[0] = 0xE0 | (codepoint >> 12);
+        o[1] = 0x80 | ((codepoint >> 6) & 0x3F);
+        o[2] = 0x80 | (codepoint & 0x3F);
+        return 3;
+    }
+
+    o[0] = 0xF0 | (codepoint >> 18);
+    o[1] = 0x80 | ((codepoint >> 12) & 0x3F);
+    o[2] = 0x80 | ((codepoint >> 6) & 0x3F);
+    o[3] = 0x80 | (codepoint & 0x3F);
+    return 4;
+}
+
+/*
+ * Decodes a single character reference starting at ref (which points to '&')
+ * Writes the replacement to out, stores its length in written and returns the number of characters consumed
+ * Returns 0 if ref isn't a well-formed reference, in which case '&' should be kept literally
+ * Like browsers, legacy names (&copy, &amp, &lt...) are decoded without the semicolon, as the longest one
+ * the name starts with, except in attribute values when followed by '=' or an alphanumeric (query strings)
+ * E.g. "&lt;p" => out = "<", written = 1, returns 4
+ *      "&#x2F;" => out = "/", written = 1, returns 6
+ *      "&#128;" => out = "€", written = 3, returns 6
+ *      "&notit;" => out = "¬", written = 2, returns 4
+ */
+size_t decode_reference(const char *ref, char *out, int *written, bool in_attribute) {
+    const char *s = ref + 1;
+
+    // Numeric reference: &#47; or &#x2F;
+    if (*s == '#') {
+        unsigned long codepoint = 0;
+        bool hex = false;
+        int digits = 0;
+
+        s++;
+        if (*s == 'x' || *s == 'X') {
+            hex = true;
+            s++;
         }
 
-        // Including new line char in the read string
-        // Adding this after offset/bufsize check because the last byte
-        // might not get allocated
-        if (c == '\n') {
-            buf[offset++] = c;
-            break;
+        while (hex ? isxdigit((unsigned char) *s) : isdigit((unsigned char) *s)) {
+            int digit = isdigit((unsigned char) *s) ? *s - '0' : (tolower((unsigned char) *s) - 'a' + 10);
+
+            // Saturate instead of overflowing, encode_utf8 replaces it anyway
+            if (codepoint <= 0x10FFFF)
+                codepoint = codepoint * (hex ? 16 : 10) + digit;
+
+            digits++;
+            s++;
         }
 
-        buf[offset++] = c;
+        if (digits == 0)
+            return 0;
+
+        // The terminating semicolon is optional for numeric references
+        if (*s == ';')
+            s++;
+
+        // C1 controls are almost always meant as Windows-1252, e.g. &#150; is an en dash
+        if (codepoint >= 0x80 && codepoint <= 0x9F)
+            codepoint = windows_1252_c1[codepoint - 0x80];
+
+        *written = encode_utf8(codepoint, out);
+        return s - ref;
     }
 
-    // Adjusting buffer size to fit the string
-    if (offset < bufsize - 1) {
-        // Zero characters read
-        if (offset == 0) {
-            free(buf);
-            return NULL;
-        }
+    // Named reference: &amp;
+    const char *name = s;
+    while (isalnum((unsigned char) *s) && s - name <= MAX_ENTITY_NAME_LEN)
+        s++;
 
-        char *new_buf = realloc(buf, offset + 1);
+    const Entity *entity = *s == ';' ? lookup_entity(name, s - name) : NULL;
+    size_t consumed = s - ref + 1;
 
-        if (new_buf == NULL) {
-            perror("Failed to adjust allocated memory for the buffer");
-            return NULL;
+    if (entity == NULL) {
+        size_t name_length = s - name < MAX_LEGACY_ENTITY_NAME_LEN ? s - name : MAX_LEGACY_ENTITY_NAME_LEN;
+
+        for (; name_length >= 2 && entity == NULL; name_length--) {
+            entity = lookup_entity(name, name_length);
+            if (entity && !entity->legacy)
+                entity = NULL;
         }
 
-        buf = new_buf;
+        if (entity == NULL)
+            return 0;
+
+        // name_length went one past the match
+        consumed = name_length + 2;
+        char next = ref[consumed];
+
+        if (in_attribute && (next == '=' || isalnum((unsigned char) next)))
+            return 0;
     }
 
-    buf[offset] = '\0';
+    *written = strlength(entity->value);
+    memcpy(out, entity->value, *written);
+    return consumed;
+}
 
-    return buf;
+/*
+ * Decodes character references in str (an attribute value if in_attribute is set, text otherwise)
+ * Returns str itself (no copy) if it contains no '&', otherwise a newly allocated decoded string
+ * The caller must free the result only if it differs from str
+ * E.g. decode_entities("a &lt; b", false) => "a < b"
+ */
+const char *decode_entities(const char *str, bool in_attribute) {
+    size_t length = strlength(str);
+
+    // memchr is vectorized by libc, so text without references is only scanned once
+    const char *amp = memchr(str, '&', length);
+    if (amp == NULL)
+        return str;
+
+    char *result = (char*) calloc(MAX_DECODED_LENGTH(length) + 1, sizeof(char));
+    if (result == NULL) {
+        perror("Failed to allocate memory for decoded string");
+        exit(1);
+    }
+
+    size_t offset = decode_entities_into(str, length, result, in_attribute);
+    result[offset] = '\0';
+
+    return result;
 }
 
+/*
+ * Decodes character references of a NUL-terminated string of a given length into out
+ * and returns the decoded length, out must hold MAX_DECODED_LENGTH(length) bytes
+ */
+size_t decode_entities_into(const char *str, size_t length, char *out, bool in_attribute) {
+    const char *s = str;
+    const char *end = str + length;
+    const char *amp = memchr(str, '&', length);
+    size_t offset = 0;
+
+    while (amp != NULL) {
+        // Copy the plain run preceding the reference
+        memcpy(out + offset, s, amp - s);
+        offset += amp - s;
 
-/* 
- * Allocates memory for an Attribute struct, initializes its fields, and returns a pointer to it 
+        int written = 0;
+        size_t consumed = decode_reference(amp, out + offset, &written, in_attribute);
+
+        if (consumed == 0) {
+            out[offset++] = '&';
+            s = amp + 1;
+        }
+        else {
+            offset += written;
+            s = amp + consumed;
+        }
+
+        amp = memchr(s, '&', end - s);
+    }
+
+    memcpy(out + offset, s, end - s);
+    offset += end - s;
+
+    return offset;
+}
+
+/*
+ * Returns the length of the valid UTF-8 sequence starting at s, or 0 if it's invalid
+ * Overlong encodings, surrogates and code points above U+10FFFF are rejected
  */
-Attribute *create_attribute(const char *name, const char *value) {
-    Attribute *attr = calloc(1, sizeof(Attribute));
-    attr->name = strdup(name);
-    attr->value = strdup(value);
-    return attr;
+int utf8_sequence_length(const unsigned char *s, const unsigned char *end) {
+    unsigned char lead = s[0];
+    unsigned char min = 0x80, max = 0xBF;
+    int length;
+
+    if (lead < 0x80) return 1;
+    else if (lead >= 0xC2 && lead <= 0xDF) length = 2;
+    else if (lead >= 0xE0 && lead <= 0xEF) length = 3;
+    else if (lead >= 0xF0 && lead <= 0xF4) length = 4;
+    else return 0;
+
+    if (end - s < length)
+        return 0;
+
+    // Second byte ranges that exclude overlongs, surrogates and > U+10FFFF
+    if (lead == 0xE0) min = 0xA0;
+    else if (lead == 0xED) max = 0x9F;
+    else if (lead == 0xF0) min = 0x90;
+    else if (lead == 0xF4) max = 0x8F;
+
+    if (s[1] < min || s[1] > max)
+        return 0;
+
+    for (int i = 2; i < length; i++) {
+        if (s[i] < 0x80 || s[i] > 0xBF)
+            return 0;
+    }
+
+    return length;
 }
 
-/* 
- * Allocates memory for a HTMLTag struct, initializes its fields, and returns a pointer to it 
+/*
+ * Returns the number of leading ASCII bytes in str
+ * Checks 16 (SSE2) or 8 bytes at a time, which is where most of the input is spent
  */
-HTMLTag *create_tag_from_string(const char *name, const char *content) {
-    HTMLTag *tag = (HTMLTag*) calloc(1, sizeof(HTMLTag));
-    
-    if (name == NULL) {
-        printf("Cannot create HTML tag without a name\n");
-        exit(1);
+size_t ascii_prefix_length(const char *str, size_t length) {
+    const unsigned char *s = (const unsigned char*) str;
+    const unsigned char *end = s + length;
+
+#ifdef __SSE2__
+    while (end - s >= 16 && _mm_movemask_epi8(_mm_loadu_si128((const __m128i*) s)) == 0)
+        s += 16;
+#endif
+    while (end - s >= 8) {
+        uint64_t block;
+        memcpy(&block, s, sizeof(block));
+        if (block & 0x8080808080808080ULL)
+            break;
+        s += 8;
     }
 
-    // Copy string name to tag's name
-    tag->name = strdup(name);
-    if (tag->name == NULL) {
-        printf("Failed to copy string '%s' to tag name\n", name);
-        exit(1);
+    while (s < end && *s < 0x80)
+        s++;
+
+    return s - (const unsigned char*) str;
+}
+
+#ifdef HAVE_SSSE3_DISPATCH
+#define UTF8_TOO_SHORT 0x01      // lead byte not followed by a continuation byte
+#define UTF8_TOO_LONG 0x02       // continuation byte after ASCII
+#define UTF8_OVERLONG_3 0x04     // E0 80..9F
+#define UTF8_TOO_LARGE 0x08      // F4 90..BF, F5..FF
+#define UTF8_SURROGATE 0x10      // ED A0..BF
+#define UTF8_OVERLONG_2 0x20     // C0..C1
+#define UTF8_TOO_LARGE_1000 0x40 // F5..FF 80..8F
+#define UTF8_OVERLONG_4 0x40     // F0 80..8F
+#define UTF8_TWO_CONTS 0x80      // two continuation bytes, valid only inside a 3 or 4 byte sequence
+#define UTF8_CARRY (UTF8_TOO_SHORT | UTF8_TOO_LONG | UTF8_TWO_CONTS)
+
+/*
+ * Validates str 16 bytes at a time and returns the length of the prefix that was checked and found valid
+ * str has to start at a sequence boundary; the prefix ends at the first bad block or before a sequence cut by the last block
+ * Every pair of adjacent bytes is classified with three nibble lookups (Keiser & Lemire, "Validating UTF-8 In Less Than One Instruction Per Byte"),
+ * 3rd and 4th bytes of a sequence are checked against the lead byte two and three positions back
+ */
+__attribute__((target("ssse3")))
+size_t validate_utf8_ssse3(const unsigned char *s, size_t length) {
+    const __m128i byte_1_high_table = _mm_setr_epi8(
+        UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG,
+        UTF8_TWO_CONTS, UTF8_TWO_CONTS, UTF8_TWO_CONTS, UTF8_TWO_CONTS,
+        UTF8_TOO_SHORT | UTF8_OVERLONG_2,
+        UTF8_TOO_SHORT,
+        UTF8_TOO_SHORT | UTF8_OVERLONG_3 | UTF8_SURROGATE,
+        UTF8_TOO_SHORT | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 | UTF8_OVERLONG_4);
+    const __m128i byte_1_low_table = _mm_setr_epi8(
+        UTF8_CARRY | UTF8_OVERLONG_3 | UTF8_OVERLONG_2 | UTF8_OVERLONG_4,
+        UTF8_CARRY | UTF8_OVERLONG_2,
+        UTF8_CARRY,
+        UTF8_CARRY,
+        UTF8_CARRY | UTF8_TOO_LARGE,
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 | UTF8_SURROGATE,
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000);
+    const __m128i byte_2_high_table = _mm_setr_epi8(
+        UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT,
+        UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_OVERLONG_3 | UTF8_TOO_LARGE_1000 | UTF8_OVERLONG_4,
+        UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_OVERLONG_3 | UTF8_TOO_LARGE,
+        UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_SURROGATE | UTF8_TOO_LARGE,
+        UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_SURROGATE | UTF8_TOO_LARGE,
+        UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT);
+    const __m128i low_nibble = _mm_set1_epi8(0x0F);
+    const __m128i zero = _mm_setzero_si128();
+
+    const unsigned char *p = s;
+    const unsigned char *end = s + length;
+    __m128i previous = zero;
+
+    while (end - p >= 16) {
+        __m128i input = _mm_loadu_si128((const __m128i*) p);
+        __m128i prev1 = _mm_alignr_epi8(input, previous, 15);
+        __m128i prev2 = _mm_alignr_epi8(input, previous, 14);
+        __m128i prev3 = _mm_alignr_epi8(input, previous, 13);
+
+        __m128i special_cases = _mm_and_si128(
+            _mm_and_si128(
+                _mm_shuffle_epi8(byte_1_high_table, _mm_and_si128(_mm_srli_epi16(prev1, 4), low_nibble)),
+                _mm_shuffle_epi8(byte_1_low_table, _mm_and_si128(prev1, low_nibble))),
+            _mm_shuffle_epi8(byte_2_high_table, _mm_and_si128(_mm_srli_epi16(input, 4), low_nibble)));
+
+        // High bit set where a byte has to be the 3rd or 4th of a sequence, which is exactly where TWO_CONTS is allowed
+        __m128i must_be_continuation = _mm_or_si128(
+            _mm_subs_epu8(prev2, _mm_set1_epi8((char) (0xE0 - 0x80))),
+            _mm_subs_epu8(prev3, _mm_set1_epi8((char) (0xF0 - 0x80))));
+        __m128i error = _mm_xor_si128(_mm_and_si128(must_be_continuation, _mm_set1_epi8((char) 0x80)), special_cases);
+
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(error, zero)) != 0xFFFF)
+            break;
+
+        previous = input;
+        p += 16;
     }
 
-    if (content != NULL) {
-        // Copy string content to tag's content
-        tag->content = strdup(content);
-        if (tag->content == NULL) {
-            printf("Failed to copy string '%s' to tag content\n", content);
-            exit(1);
+    // A sequence cut by the end of the last block hasn't been checked yet
+    for (int i = 1; i <= 3 && p - i >= s; i++) {
+        unsigned char byte = p[-i];
+
+        if (byte < 0x80)
+            break;
+
+        if (byte >= 0xC0) {
+            int sequence_length = byte >= 0xF0 ? 4 : byte >= 0xE0 ? 3 : 2;
+            if (i < sequence_length)
+                p -= i;
+            break;
         }
     }
 
-    return tag;
+    return p - s;
 }
+#endif
 
-/* 
- * Dynamically adds child tag to the parent tag 
+/*
+ * Returns the length of the longest valid UTF-8 prefix of str
+ * Equal to length if the whole string is valid
  */
-void add_child(HTMLTag *parent, HTMLTag *child) {
-    if (parent == NULL || child == NULL) return;
+size_t validate_utf8(const char *str, size_t length) {
+    const unsigned char *s = (const unsigned char*) str;
+    const unsigned char *end = s + length;
+#ifdef HAVE_SSSE3_DISPATCH
+    bool ssse3 = __builtin_cpu_supports("ssse3");
+#endif
+
+    while (s < end) {
+        // ASCII runs are skipped a block at a time
+        s += ascii_prefix_length((const char*) s, end - s);
+
+        if (s == end)
+            break;
 
-    if (parent->children_length == 0) {
-        parent->children_length++;
-        parent->children = (HTMLTag**) malloc(sizeof(HTMLTag*));
+#ifdef HAVE_SSSE3_DISPATCH
+        // Multi-byte text is validated 16 bytes at a time, the scalar check below only runs where a block failed
+        if (ssse3 && end - s >= 16) {
+            s += validate_utf8_ssse3(s, end - s);
 
-        if (parent->children == NULL) {
-            free(parent->children);
-            printf("Failed to allocate memory for children HTMLTag\n");
-            exit(1);
+            if (s == end)
+                break;
         }
+#endif
 
-        *(parent->children + parent->children_length - 1) = child;
+        int sequence_length = utf8_sequence_length(s, end);
+        if (sequence_length == 0)
+            break;
+
+        s += sequence_length;
     }
-    else {
-        parent->children_length++;
-        HTMLTag **new_children_ptr = (HTMLTag**) realloc(parent->children, sizeof(HTMLTag*) * parent->children_length);
 
-        if (new_children_ptr == NULL) {
-            free(new_children_ptr);
-            printf("Failed to reallocate memory for children HTMLTags\n");
-            exit(1);
+    return s - (const unsigned char*) str;
+}
+
+/*
+ * Returns a newly allocated copy of str with every byte that isn't part of a valid UTF-8 sequence replaced with U+FFFD
+ * The number of replacements is stored in replaced
+ */
+char *replace_invalid_utf8(const char *str, size_t length, int *replaced) {
+    const unsigned char *s = (const unsigned char*) str;
+    const unsigned char *end = s + length;
+
+    // Every invalid byte expands to at most 3 bytes
+    char *result = (char*) calloc(length * 3 + 1, sizeof(char));
+    size_t offset = 0;
+
+    if (result == NULL) {
+        perror("Failed to allocate memory for the UTF-8 replacement");
+        exit(1);
+    }
+
+    *replaced = 0;
+
+    while (s < end) {
+        // Copy the valid run at once
+        size_t valid = validate_utf8((const char*) s, end - s);
+        memcpy(result + offset, s, valid);
+        offset += valid;
+        s += valid;
+
+        if (s < end) {
+            offset += encode_utf8(0xFFFD, result + offset);
+            (*replaced)++;
+            s++;
         }
+    }
 
-        parent->children = new_children_ptr;
-        *(parent->children + parent->children_length - 1) = child;
+    result[offset] = '\0';
+    return result;
+}
+
+/*
+ * Maps an encoding label to the decoder used for it, the whole label has to match (case-insensitively)
+ * Like browsers, ISO-8859-1 and US-ASCII are treated as Windows-1252
+ * Other encodings aren't supported and are decoded as UTF-8 (invalid bytes become U+FFFD)
+ * E.g. "latin1" => "windows-1252", "iso-8859-15" => "utf-8"
+ */
+char *charset_for_label(const char *label, size_t label_length) {
+    char *latin_labels[] = {
+        "windows-1252", "x-cp1252", "cp1252", "iso-8859-1", "iso8859-1", "iso88591", "iso_8859-1",
+        "iso_8859-1:1987", "iso-ir-100", "latin1", "l1", "cp819", "ibm819", "csisolatin1",
+        "us-ascii", "ascii", "ansi_x3.4-1968",
+    };
+    char *utf8_labels[] = { "utf-8", "utf8", "unicode-1-1-utf-8", "unicode11utf8", "unicode20utf8", "x-unicode20utf8" };
+
+    for (int i = 0; i < (int) (sizeof(latin_labels) / sizeof(char*)); i++) {
+        if (strlength(latin_labels[i]) == label_length && strncasecmp(label, latin_labels[i], label_length) == 0)
+            return "windows-1252";
+    }
+
+    for (int i = 0; i < (int) (sizeof(utf8_labels) / sizeof(char*)); i++) {
+        if (strlength(utf8_labels[i]) == label_length && strncasecmp(label, utf8_labels[i], label_length) == 0)
+            return "utf-8";
     }
+
+    printf("Unsupported charset %.*s, decoding as UTF-8\n", (int) label_length, label);
+    return "utf-8";
 }
 
-/* 
- * Dynamically adds an attribute to the tag 
+/*
+ * Looks for a charset declaration (<meta charset="..."> or <meta content="...; charset=...">) between str and end
+ * Only <meta> tags are looked at, so text mentioning "charset=" doesn't count
+ * Returns "utf-8", "windows-1252" or NULL if there's none
  */
-void add_attribute(HTMLTag *tag, Attribute *attr) {
-    if (tag == NULL || attr == NULL) return;
+char *detect_charset(const char *str, const char *end) {
+    const char *meta = str;
 
-    if (tag->attribute_length == 0) {
-        tag->attributes = (Attribute**) malloc(sizeof(Attribute*));
+    while ((meta = strcasestr(meta, "<meta")) != NULL && meta < end) {
+        const char *tag_end = memchr(meta, '>', end - meta);
+        if (tag_end == NULL)
+            tag_end = end;
 
-        if (tag->attributes == NULL) {
-            free(tag->attributes);
-            perror("Failed to allocate memory for Attributes");
-            exit(1);
-        }
+        for (const char *s = meta + 5; tag_end - s > 7; s++) {
+            if (strncasecmp(s, "charset", 7) != 0)
+                continue;
 
-        *(tag->attributes + tag->attribute_length) = attr;
-        tag->attribute_length++;
-    }
-    else {
-        tag->attribute_length++;
-        Attribute **new_attr_ptr = (Attribute**) realloc(tag->attributes, sizeof(Attribute*) * tag->attribute_length);
+            const char *label = s + 7;
+            while (label < tag_end && *label == ' ')
+                label++;
 
-        if (new_attr_ptr == NULL) {
-            free(new_attr_ptr);
-            perror("Failed to reallocate memory for Attributes");
-            exit(1);
+            if (label == tag_end || *label != '=')
+                continue;
+
+            label++;
+            while (label < tag_end && (*label == ' ' || *label == '"' || *label == '\''))
+                label++;
+
+            const char *label_end = label;
+            while (label_end < tag_end && !strchr("\"'; />", *label_end))
+                label_end++;
+
+            return charset_for_label(label, label_end - label);
         }
 
-        tag->attributes = new_attr_ptr;
-        *(tag->attributes + tag->attribute_length - 1) = attr;
+        meta = tag_end;
     }
+
+    return NULL;
 }
 
-/* 
- * Searches for the next tag in a line pointed to by line_ptr 
- * Once found, it shifts the line pointer to the next character after the closing arrow of found tag 
- *
- * E.g. next_tag(&"<span><a></a></span>") returns tag; line_ptr = &"<a></a></span>"
- *      next_tag(&"<a></a></span>") returns tag; line_ptr = &"</a></span>"
- *      ...
+/*
+ * Returns a newly allocated UTF-8 copy of a Windows-1252 encoded string
  */
-HTMLTag *next_tag(char **line_ptr) {
-    char *expected_token = "open_tag";
+char *transcode_windows_1252(const char *str, size_t length) {
+    const unsigned char *s = (const unsigned char*) str;
+    char *result = (char*) calloc(length * 3 + 1, sizeof(char));
+    size_t offset = 0;
 
-    Attribute *attr = NULL;
-    char *attr_name = (char*) calloc(128, sizeof(char));
-    char *attr_value = (char*) calloc(128, sizeof(char));
+    if (result == NULL) {
+        perror("Failed to allocate memory for the transcoded string");
+        exit(1);
+    }
 
-    HTMLTag *tag = NULL;
-    char *tag_name = (char*) calloc(128, sizeof(char));
-    char *tag_content = (char*) calloc(1024, sizeof(char));
+    for (size_t i = 0; i < length; i++) {
+        if (s[i] < 0x80)
+            result[offset++] = s[i];
+        else if (s[i] < 0xA0)
+            offset += encode_utf8(windows_1252_c1[s[i] - 0x80], result + offset);
+        else
+            offset += encode_utf8(s[i], result + offset);
+    }
 
-    char *line = *line_ptr; // To be able to mutate the pointer to the line we need to modify a pointer to the pointer to the line
-    bool error_exit = false;
-    int offset = 0;
+    result[offset] = '\0';
+    return result;
+}
 
-    // Character at which is pointing the line pointer
-    int chr;
+/*
+ * Prepares a line read from the input for the tokenizer, so that it only ever sees valid UTF-8
+ * Strips the byte order mark, follows charset declarations, transcodes Windows-1252 input
+ * and replaces invalid UTF-8 sequences with U+FFFD
+ * Returns either line itself or a newly allocated replacement (line is freed in that case)
+ * length_ptr holds the length of line and is updated to the length of the result, which can
+ * differ even when line itself is returned (the BOM is stripped in place)
+ */
+char *normalize_line(char *line, size_t *length_ptr, LineDecoder *decoder) {
+    size_t length = *length_ptr;
+    char *result = line;
+
+    // A UTF-8 BOM takes precedence over any declaration, so it's the only case where we ignore <meta charset>
+    if (decoder->first_line && length >= 3 && memcmp(line, "\xEF\xBB\xBF", 3) == 0) {
+        memmove(line, line + 3, length - 2);
+        length -= 3;
+        *length_ptr = length;
+        decoder->windows_1252 = false;
+        decoder->charset_known = true;
+    }
+    else if (!decoder->charset_known) {
+        // Declarations count only in the head, and only the first one
+        const char *body = strcasestr(line, "<body");
+        char *charset = detect_charset(line, body ? body : line + length);
 
-    printf("Current line: %s\n", line);
-    printf("Expected: %s\n", expected_token);
+        if (charset != NULL)
+            decoder->windows_1252 = strequals(charset, "windows-1252");
 
-    // TODO: Maybe replace this implementation with regexes
-    while ((chr = *line), chr != EOF && chr != '\n') {
-        // We parse tags character by character following the chain of expected tokens:
-        //   
-        //   
+        decoder->charset_known = charset != NULL || body != NULL;
+    }
+
+    decoder->first_line = false;
+
+    if (decoder->windows_1252) {
+        // Pure ASCII is the same in both encodings
+        if (ascii_prefix_length(line, length) == length)
+            return line;
+
+        result = transcode_windows_1252(line, length);
+    }
+    else {
+        size_t valid = validate_utf8(line, length);
+
+        if (valid == length)
+            return line;
+
+        int replaced = 0;
+        result = replace_invalid_utf8(line, length, &replaced);
+        printf("Replaced %d invalid UTF-8 byte(s)\n", replaced);
+    }
+
+    free(line);
+    *length_ptr = strlength(result);
+    return result;
+}
+
+/* 
+ * Opens a file stream and returns a pointer to it
+ * Gzip and zstd compressed files are detected by their magic bytes and decompressed on the fly,
+ * decompressor is set for them (NULL otherwise) and the stream has to be closed with close_file()
+ */
+FILE *open_file(const char *fname, Decompressor **decompressor) {
+    FILE *fptr;
+    unsigned char magic[4];
+
+    *decompressor = NULL;
+    fptr = fopen(fname, "r");
+    if (!fptr) {
+        perror("File opening failed");
+        return NULL;
+    }
+
+    // pread doesn't move the file offset, so the stream still starts at the beginning
+    ssize_t magic_length = pread(fileno(fptr), magic, sizeof(magic), 0);
+    char *format = detect_compression(magic, magic_length > 0 ? magic_length : 0);
+
+    if (format == NULL)
+        return fptr;
+
+    return open_decompressed(fptr, format, decompressor);
+}
+
+/*
+ * Closes a stream returned by open_file() or open_decompressed() and waits for its decompression thread
+ * Returns false if the input couldn't be decompressed, e.g. a truncated .gz file
+ * A reader that stopped before the end makes the thread fail on purpose, that isn't an error
+ */
+bool close_file(FILE *stream, Decompressor *decompressor) {
+    bool drained = feof(stream);
+
+    fclose(stream);
+
+    if (decompressor == NULL)
+        return true;
+
+    pthread_join(decompressor->thread, NULL);
+
+    bool ok = decompressor->ok || !drained;
+    if (!ok)
+        printf("Failed to decompress %s input\n", decompressor->format);
+
+    free(decompressor);
+    return ok;
+}
+
+/*
+ * Returns the compression format ("gzip" or "zstd") of a file by its first bytes, or NULL if it isn't compressed
+ */
+char *detect_compression(const unsigned char *magic, size_t length) {
+    if (length >= 2 && magic[0] == 0x1F && magic[1] == 0x8B)
+        return "gzip";
+
+    if (length >= 4 && magic[0] == 0x28 && magic[1] == 0xB5 && magic[2] == 0x2F && magic[3] == 0xFD)
+        return "zstd";
+
+    return NULL;
+}
+
+/*
+ * Starts decompressing source in a separate thread and returns a stream of the decompressed data
+ * The thread writes into a pipe, so decompression overlaps with tokenization and
+ * at most a pipe's worth of decompressed data is held in memory
+ * The stream has to be closed with close_file(decompressor), which reports whether decompression succeeded
+ */
+FILE *open_decompressed(FILE *source, char *format, Decompressor **decompressor_ptr) {
+    int fds[2];
+
+    if (pipe(fds) < 0) {
+        perror("Failed to create decompression pipe");
+        fclose(source);
+        return NULL;
+    }
+
+    // A bigger pipe means fewer context switches between the two stages (Linux only, best effort)
+#ifdef F_SETPIPE_SZ
+    fcntl(fds[1], F_SETPIPE_SZ, DECOMPRESS_PIPE_SIZE);
+#endif
+
+    // If the reader stops early, writes fail with EPIPE instead of killing the process
+    signal(SIGPIPE, SIG_IGN);
+
+    Decompressor *decompressor = (Decompressor*) calloc(1, sizeof(Decompressor));
+    if (decompressor == NULL) {
+        perror("Failed to allocate memory for the decompressor");
+        exit(1);
+    }
+
+    decompressor->source = source;
+    decompressor->fd = fds[1];
+    decompressor->format = format;
+
+    if (pthread_create(&decompressor->thread, NULL, decompress_to_pipe, decompressor) != 0) {
+        perror("Failed to start decompression thread");
+        exit(1);
+    }
+
+    FILE *stream = fdopen(fds[0], "r");
+    if (!stream) {
+        perror("Failed to open decompression pipe");
+
+        // The thread stops at its first write
+        close(fds[0]);
+        pthread_join(decompressor->thread, NULL);
+        free(decompressor);
+        return NULL;
+    }
+
+    *decompressor_ptr = decompressor;
+    return stream;
+}
+
+/*
+ * Decompression thread: decompresses the source into the pipe, then closes both
+ * Closing the pipe signals EOF to the tokenizer, the result is left in decompressor->ok for close_file()
+ */
+void *decompress_to_pipe(void *arg) {
+    Decompressor *decompressor = (Decompressor*) arg;
+
+    if (strequals(decompressor->format, "gzip"))
+        decompressor->ok = decompress_gzip(decompressor->source, decompressor->fd);
+    else
+        decompressor->ok = decompress_zstd(decompressor->source, decompressor->fd);
+
+    close(decompressor->fd);
+    fclose(decompressor->source);
+
+    return NULL;
+}
+
+/*
+ * Writes a chunk of decompressed data to the pipe
+ * Returns false on error, e.g. when the reader has gone away
+ */
+bool write_chunk(int fd, const void *buf, size_t length) {
+    const char *b = (const char*) buf;
+
+    while (length > 0) {
+        ssize_t n = write(fd, b, length);
+        if (n < 0)
+            return false;
+
+        b += n;
+        length -= n;
+    }
+
+    return true;
+}
+
+/*
+ * Streams a gzip (possibly multi-member) file into fd
+ */
+bool decompress_gzip(FILE *source, int fd) {
+    unsigned char in[DECOMPRESS_CHUNK_SIZE];
+    unsigned char out[DECOMPRESS_CHUNK_SIZE];
+    z_stream stream = { 0 };
+    bool output_full = false;
+    bool ended = false; // the last member was complete
+    bool ok = true;
+
+    // 15 + 16: maximum window, gzip header
+    if (inflateInit2(&stream, 15 + 16) != Z_OK)
+        return false;
+
+    while (true) {
+        // A full output buffer may leave output pending inside zlib, so only read more input after draining it
+        if (stream.avail_in == 0 && !output_full) {
+            stream.avail_in = fread(in, 1, sizeof(in), source);
+            stream.next_in = in;
+
+            if (stream.avail_in == 0)
+                break;
+        }
+
+        // Concatenated gzip members decompress into one stream, a new member only starts if there's input for it
+        if (ended) {
+            inflateReset(&stream);
+            ended = false;
+        }
+
+        stream.avail_out = sizeof(out);
+        stream.next_out = out;
+
+        int ret = inflate(&stream, Z_NO_FLUSH);
+        if (ret != Z_OK && ret != Z_STREAM_END && ret != Z_BUF_ERROR) {
+            ok = false;
+            break;
+        }
+
+        // At the end of a member everything has been flushed, even if the output buffer is exactly full
+        ended = ret == Z_STREAM_END;
+        output_full = !ended && stream.avail_out == 0;
+
+        if (!write_chunk(fd, out, sizeof(out) - stream.avail_out)) {
+            ok = false;
+            break;
+        }
+    }
+
+    inflateEnd(&stream);
+    return ok && ended;
+}
+
+/*
+ * Streams a zstd file into fd
+ */
+bool decompress_zstd(FILE *source, int fd) {
+#ifdef HAVE_ZSTD
+    unsigned char in[DECOMPRESS_CHUNK_SIZE];
+    unsigned char out[DECOMPRESS_CHUNK_SIZE];
+    ZSTD_DStream *stream = ZSTD_createDStream();
+    size_t ret = 0;
+    bool ok = true;
+
+    if (stream == NULL)
+        return false;
+
+    ZSTD_initDStream(stream);
+
+    size_t read_length;
+    while (ok && (read_length = fread(in, 1, sizeof(in), source)) > 0) {
+        ZSTD_inBuffer input = { in, read_length, 0 };
+
+        // Keep calling until the input is consumed and the output isn't full anymore
+        while (input.pos < input.size || ret > 0) {
+            ZSTD_outBuffer output = { out, sizeof(out), 0 };
+
+            ret = ZSTD_decompressStream(stream, &output, &input);
+            if (ZSTD_isError(ret) || !write_chunk(fd, out, output.pos)) {
+                ok = false;
+                break;
+            }
+
+            if (input.pos == input.size && output.pos < output.size)
+                break;
+        }
+    }
+
+    ZSTD_freeDStream(stream);
+
+    // ret is 0 once a frame is completely decoded and flushed
+    return ok && ret == 0;
+#else
+    (void) source;
+    (void) fd;
+    printf("zstd support isn't compiled in (build with -DHAVE_ZSTD -lzstd)\n");
+    return false;
+#endif
+}
+
+/* 
+ * Reads a line from file stream
+ */
+char *readline(FILE *fp) {
+    int offset = 0;
+    int bufsize = 4;
+    char *buf = (char*) calloc(bufsize, sizeof(char));
+    int c;
+
+    if (buf == NULL) {
+        perror("Failed to allocate memory for the buffer");
+        return NULL;
+    }
+
+    // Right-most expression in while-loop must be the condition
+    while(c = fgetc(fp), c != EOF) {
+        if (offset == bufsize - 1) { // -1 for the NULL terminator
+            bufsize *= 2;
+
+            char *new_buf = realloc(buf, bufsize);
+            if (new_buf == NULL) {
+                perror("Failed to reallocate memory for the buffer");
+                return NULL;
+            }
+
+            buf = new_buf;
+        }
+
+        // Including new line char in the read string
+        // Adding this after offset/bufsize check because the last byte
+        // might not get allocated
+        if (c == '\n') {
+            buf[offset++] = c;
+            break;
+        }
+
+        buf[offset++] = c;
+    }
+
+    // Adjusting buffer size to fit the string
+    if (offset < bufsize - 1) {
+        // Zero characters read
+        if (offset == 0) {
+            free(buf);
+            return NULL;
+        }
+
+        char *new_buf = realloc(buf, offset + 1);
+
+        if (new_buf == NULL) {
+            perror("Failed to adjust allocated memory for the buffer");
+            return NULL;
+        }
+
+        buf = new_buf;
+    }
+
+    buf[offset] = '\0';
+
+    return buf;
+}
+
+
+/* 
+ * Allocates memory for an Attribute struct, initializes its fields, and returns a pointer to it 
+ */
+Attribute *create_attribute(InternTable *table, const char *name, const char *value) {
+    Attribute *attr = calloc(1, sizeof(Attribute));
+
+    // Names repeat all over a page (class, href, id), so each distinct one is stored once
+    attr->name = intern_string(table, name);
+
+    // Character references in the value are decoded before interning
+    const char *decoded_value = decode_entities(value, true);
+    attr->value_interned = str_in_arr((char*) attr->name, interned_value_attributes, INTERNED_VALUE_ATTRIBUTES_LEN);
+
+    if (attr->value_interned) {
+        attr->value = intern_string(table, decoded_value);
+
+        if (decoded_value != value)
+            free((char*) decoded_value);
+    }
+    else {
+        attr->value = decoded_value != value ? decoded_value : strdup(value);
+
+        if (attr->value == NULL) {
+            perror("Failed to copy attribute value");
+            exit(1);
+        }
+    }
+
+    return attr;
+}
+
+/* 
+ * Allocates memory for a HTMLTag struct, initializes its fields, and returns a pointer to it 
+ */
+HTMLTag *create_tag_from_string(const char *name, const char *content) {
+    HTMLTag *tag = (HTMLTag*) calloc(1, sizeof(HTMLTag));
+    
+    if (name == NULL) {
+        printf("Cannot create HTML tag without a name\n");
+        exit(1);
+    }
+
+    // Copy string name to tag's name
+    tag->name = strdup(name);
+    if (tag->name == NULL) {
+        printf("Failed to copy string '%s' to tag name\n", name);
+        exit(1);
+    }
+
+    if (content != NULL) {
+        // Copy string content to tag's content, decoding character references on the way
+        const char *decoded_content = decode_entities(content, false);
+        tag->content = decoded_content != content ? (char*) decoded_content : strdup(content);
+        if (tag->content == NULL) {
+            printf("Failed to copy string '%s' to tag content\n", content);
+            exit(1);
+        }
+    }
+
+    return tag;
+}
+
+/* 
+ * Dynamically adds child tag to the parent tag 
+ */
+void add_child(HTMLTag *parent, HTMLTag *child) {
+    if (parent == NULL || child == NULL) return;
+
+    if (parent->children_length == 0) {
+        parent->children_length++;
+        parent->children = (HTMLTag**) malloc(sizeof(HTMLTag*));
+
+        if (parent->children == NULL) {
+            free(parent->children);
+            printf("Failed to allocate memory for children HTMLTag\n");
+            exit(1);
+        }
+
+        *(parent->children + parent->children_length - 1) = child;
+    }
+    else {
+        parent->children_length++;
+        HTMLTag **new_children_ptr = (HTMLTag**) realloc(parent->children, sizeof(HTMLTag*) * parent->children_length);
+
+        if (new_children_ptr == NULL) {
+            free(new_children_ptr);
+            printf("Failed to reallocate memory for children HTMLTags\n");
+            exit(1);
+        }
+
+        parent->children = new_children_ptr;
+        *(parent->children + parent->children_length - 1) = child;
+    }
+}
+
+/*
+ * Appends a character to a NUL-terminated buffer at offset, doubling the buffer when it's full
+ * Lines have no length limit (minified pages are a single line), so neither has text or an attribute value
+ */
+void append_char(char **buf, size_t *size, int *offset, int chr) {
+    if ((size_t) *offset + 2 > *size) {
+        char *new_buf = (char*) realloc(*buf, *size * 2);
+
+        if (new_buf == NULL) {
+            perror("Failed to reallocate memory for the tag buffer");
+            exit(1);
+        }
+
+        *buf = new_buf;
+        *size *= 2;
+    }
+
+    (*buf)[(*offset)++] = chr;
+    (*buf)[*offset] = '\0';
+}
+
+/* 
+ * Dynamically adds an attribute to the tag 
+ */
+void add_attribute(HTMLTag *tag, Attribute *attr) {
+    if (tag == NULL || attr == NULL) return;
+
+    if (tag->attribute_length == 0) {
+        tag->attributes = (Attribute**) malloc(sizeof(Attribute*));
+
+        if (tag->attributes == NULL) {
+            free(tag->attributes);
+            perror("Failed to allocate memory for Attributes");
+            exit(1);
+        }
+
+        *(tag->attributes + tag->attribute_length) = attr;
+        tag->attribute_length++;
+    }
+    else {
+        tag->attribute_length++;
+        Attribute **new_attr_ptr = (Attribute**) realloc(tag->attributes, sizeof(Attribute*) * tag->attribute_length);
+
+        if (new_attr_ptr == NULL) {
+            free(new_attr_ptr);
+            perror("Failed to reallocate memory for Attributes");
+            exit(1);
+        }
+
+        tag->attributes = new_attr_ptr;
+        *(tag->attributes + tag->attribute_length - 1) = attr;
+    }
+}
+
+/* 
+ * Searches for the next tag in a line pointed to by line_ptr 
+ * Once found, it shifts the line pointer to the next character after the closing arrow of found tag 
+ *
+ * On a syntax error or an unknown tag it returns NULL and points error to a message, otherwise error is set to NULL
+ *
+ * E.g. next_tag(&"<span><a></a></span>", &error) returns tag; line_ptr = &"<a></a></span>"
+ *      next_tag(&"<a></a></span>", &error) returns tag; line_ptr = &"</a></span>"
+ *      next_tag(&"<nav>", &error) returns NULL; error = "Got invalid tag"
+ *      ...
+ */
+HTMLTag *next_tag(char **line_ptr, InternTable *table, const char **error) {
+    char *expected_token = "open_tag";
+
+    Attribute *attr = NULL;
+    size_t attr_name_size = TAG_BUFFER_INITIAL_SIZE;
+    size_t attr_value_size = TAG_BUFFER_INITIAL_SIZE;
+    char *attr_name = (char*) calloc(attr_name_size, sizeof(char));
+    char *attr_value = (char*) calloc(attr_value_size, sizeof(char));
+
+    HTMLTag *tag = NULL;
+    size_t tag_name_size = TAG_BUFFER_INITIAL_SIZE;
+    size_t tag_content_size = TAG_CONTENT_INITIAL_SIZE;
+    char *tag_name = (char*) calloc(tag_name_size, sizeof(char));
+    char *tag_content = (char*) calloc(tag_content_size, sizeof(char));
+
+    char *line = *line_ptr; // To be able to mutate the pointer to the line we need to modify a pointer to the pointer to the line
+    const char *error_message = NULL;
+    int offset = 0;
+
+    // Character at which is pointing the line pointer
+    int chr;
+
+    trace("Current line: %s\n", line);
+    trace("Expected: %s\n", expected_token);
+
+    // TODO: Maybe replace this implementation with regexes
+    // Bytes are read as unsigned so that UTF-8 continuation bytes are never negative (or mistaken for EOF)
+    while ((chr = (unsigned char) *line), chr != '\0' && chr != '\n') {
+        // We parse tags character by character following the chain of expected tokens:
+        //   
+        //   
         //             attr_value_open     attr_separator_or_close_tag
         //     open_tag    |                         |
         //       |         |                         |\ 
@@ -557,7 +1895,7 @@ HTMLTag *next_tag(char **line_ptr) {
             if (chr == '-') {
                 if (strlength(line) >= 3) {
                     if (*(line + 1) == '-' && *(line + 2) == '>') {
-                        printf("Comment closed\n");
+                        trace("Comment closed\n");
                         COMMENT_OPENED = false;
                         expected_token = "open_tag";
                         line += 3;
@@ -566,365 +1904,3329 @@ HTMLTag *next_tag(char **line_ptr) {
                 }
             }
         }
-        else if (strequals(expected_token, "open_tag")) {
-            if (chr == '<') {
-                expected_token = "tag_name";
-                offset = 0;
-                printf("Expected: %s\n", expected_token);
-            }
-            // We skip spaces if there is no content
-            else if (chr == ' ' && strlength(tag_content) == 0){
-                line++;
-                continue;
-            }
-            else {
-                tag_content[offset++] = chr;
-            }
+        else if (strequals(expected_token, "open_tag")) {
+            if (chr == '<') {
+                expected_token = "tag_name";
+                offset = 0;
+                trace("Expected: %s\n", expected_token);
+            }
+            // We skip spaces if there is no content
+            else if (chr == ' ' && strlength(tag_content) == 0){
+                line++;
+                continue;
+            }
+            else {
+                append_char(&tag_content, &tag_content_size, &offset, chr);
+            }
+        }
+        else if (strequals(expected_token, "tag_name")) {
+            if (isalnum(chr) || chr == '/') {
+                append_char(&tag_name, &tag_name_size, &offset, chr);
+            }
+            else if (chr == '>' && strlength(tag_name) > 0) {
+                // If the tag is not of closing type, it can't have content
+                if (tag_name[0] != '/') {
+                    free(tag_content);
+                    tag_content = NULL;
+                } 
+
+                tag = create_tag_from_string(tag_name, tag_content);
+                line++;
+                trace("Closing arrow\n");
+
+                if (!is_valid_tag(tag))
+                    error_message = "Got invalid tag";
+                break;
+            }
+            else if (chr == ' ' && strlength(tag_name) > 0) {
+                // TODO: In here we know for sure it's an opening tag.
+                // If tag_content isn't empty, means that it's arbitrary text
+                // that belongs to this tag's parent. Shadow text tag
+                tag = create_tag_from_string(tag_name, NULL);
+                expected_token = "attr_name";
+                offset = 0;
+
+                if (!is_valid_tag(tag)) {
+                    error_message = "Got invalid tag";
+                    break;
+                }
+
+                trace("Expected: %s\n", expected_token);
+            }
+            // Document type declaration, e.g. <!DOCTYPE html>, has nothing to represent so we skip it
+            else if (chr == '!' && strncasecmp(line + 1, "doctype", 7) == 0) {
+                char *closing_arrow = strchr(line, '>');
+
+                if (closing_arrow == NULL) {
+                    error_message = "Invalid doctype syntax";
+                    printf("Invalid doctype syntax.\n");
+                    break;
+                }
+
+                expected_token = "open_tag";
+                line = closing_arrow + 1;
+                continue;
+            }
+            // Comment tag
+            else if (chr == '!') {
+                // !--
+                trace("Comment opened\n");
+                if (strlength(line) >= 3 && *(line + 1) == '-' && *(line + 2) == '-') {
+                    COMMENT_OPENED = true;
+                    line += 3;
+                    continue;
+                }
+
+                error_message = "Invalid comment syntax";
+                printf("Invalid comment syntax.\n");
+                break;
+            }
+            else {
+                error_message = "Bad tag name";
+                printf("Expected %s: Bad tag\n", expected_token);
+                break;
+            }
+        }
+        else if (strequals(expected_token, "attr_name")) {
+            if (isalpha(chr)) {
+                append_char(&attr_name, &attr_name_size, &offset, chr);
+            }
+            // Attribute value separator
+            else if (chr == '=' && strlength(attr_name) > 0) {
+                expected_token = "attr_value_open";
+                offset = 0;
+
+                trace("Expected: %s\n", expected_token);
+            }
+            else {
+                error_message = "Bad attribute name";
+                printf("Expected %s: Bad tag\n", expected_token);
+                break;
+            }
+        }
+        else if (strequals(expected_token, "attr_value_open")) {
+            if (chr == '"') {
+                expected_token = "attr_value";
+                trace("Expected: %s\n", expected_token);
+            }
+            else {
+                error_message = "No opening quotes in attribute value";
+                printf("Expected %s: Bad tag. No opening quotes in attribute value\n", expected_token);
+                break;
+            }
+        }
+        else if (strequals(expected_token, "attr_value")) {
+            // Non-ASCII bytes are part of (already validated) UTF-8 text
+            if (chr >= 0x80 || isalnum(chr) || char_in(VALID_ATTR_SPECIAL_CHARS, chr)) {
+                append_char(&attr_value, &attr_value_size, &offset, chr);
+            }
+            else if (chr == '"') {
+                expected_token = "attr_separator_or_close_tag";
+                offset = 0;
+
+                // Add attr to HTMLTag
+                attr = create_attribute(table, attr_name, attr_value);
+                add_attribute(tag, attr);
+
+                trace("Expected: %s\n", expected_token);
+
+                free(attr_name);
+                free(attr_value);
+
+                // Reset pointers to null so that we know we don't need to free them anymore
+                // We don't free attr because it's a pointer that's now attached to the tag
+                attr = NULL;
+                attr_name = NULL;
+                attr_value = NULL;
+            }
+            else {
+                error_message = "Bad attribute value";
+                printf("Expected %s: Bad tag.\n", expected_token);
+                break;
+            }
+        }
+        else if (strequals(expected_token, "attr_separator_or_close_tag")) {
+            if (chr == ' ') {
+                expected_token = "attr_name";
+
+                // Reallocate freed pointers
+                attr_name_size = TAG_BUFFER_INITIAL_SIZE;
+                attr_value_size = TAG_BUFFER_INITIAL_SIZE;
+                attr_name = (char*) calloc(attr_name_size, sizeof(char));
+                attr_value = (char*) calloc(attr_value_size, sizeof(char));
+
+                trace("Expected: %s\n", expected_token);
+            }
+            else if (chr == '>') {
+                trace("Closing arrow\n");
+                line++;
+                break;
+            }
+            else {
+                error_message = "Bad attribute separator";
+                printf("Expected %s: Bad tag.\n", expected_token);
+                break;
+            }
+        }
+
+        // Advance the line pointer
+        line++;
+    }
+
+    // Free all allocated pointers
+    if (attr_name) free(attr_name);
+    if (attr_value) free(attr_value);
+    if (tag_name) free(tag_name);
+    if (tag_content) free(tag_content);
+
+    *error = error_message;
+
+    if (error_message) {
+        if (tag) {
+            free_tag(tag);
+        } 
+        return NULL;
+    }
+
+    *line_ptr = line;
+
+    return tag;
+}
+
+/*
+ * Parses a whole document and returns its root tag (NULL for an empty document)
+ * Attribute names and values are interned into table, which has to outlive the tree
+ * Malformed input returns NULL and points error to a message, error is set to NULL otherwise
+ */
+HTMLTag *parse_tags(FILE *stream, InternTable *table, const char **error) {
+    return parse_tags_until(stream, NULL, table, error);
+}
+
+/*
+ * Frees the tags that are still open while parsing: current_tag and its ancestors
+ * Open tags aren't attached to their parents yet, so each one is freed on its own
+ */
+void free_open_tags(HTMLTag *current_tag) {
+    while (current_tag != NULL) {
+        HTMLTag *parent = current_tag->parent;
+        free_tag(current_tag);
+        current_tag = parent;
+    }
+}
+
+/*
+ * Updates the counters of a stop condition after a tag was parsed and returns true once parsing can stop
+ * completed_tag is the element that was just closed (or a non-closing tag), otherwise NULL
+ * E.g. { .close_tag = "head" } stops right after </head>, { .match_tag = "a", .match_count = 10 } after the 10th </a>
+ */
+bool stop_condition_met(StopCondition *stop, HTMLTag *completed_tag) {
+    if (completed_tag != NULL && stop->close_tag != NULL && strcasecmp(completed_tag->name, stop->close_tag) == 0)
+        return true;
+
+    if (completed_tag != NULL && stop->match_tag != NULL && strcasecmp(completed_tag->name, stop->match_tag) == 0 &&
+        ++stop->matches_length >= stop->match_count)
+        return true;
+
+    if (stop->max_nodes > 0 && stop->nodes_length >= stop->max_nodes)
+        return true;
+
+    return stop->max_bytes > 0 && stop->bytes_parsed >= stop->max_bytes;
+}
+
+/*
+ * Parses tags like parse_tags(), but stops reading the input as soon as the stop condition is met
+ * The elements still open at that point are closed, so the result is a valid (partial) tree
+ * A NULL stop condition parses the whole input
+ * Malformed input returns NULL and points error to a message, like parse_tags()
+ */
+HTMLTag *parse_tags_until(FILE *stream, StopCondition *stop, InternTable *table, const char **error) {
+    // Here's the idea:
+    // Find opening tag, set it as current_tag
+    // If another opening tag is found, set it as current_tag and parent is previous_tag
+    // If a closing tag is found and it matches current_tag, set current_tag as a child of its parent, and set current_tag to parent 
+    // If a closing tag is found and there's no parent, we reached the root tag
+    // If a closing tag is found and it doesn't match the current_tag, throw an error "Invalid syntax"
+    // Continue parsing
+    
+    char *line = NULL;
+    HTMLTag *current_tag = NULL;
+    LineDecoder decoder = { .first_line = true };
+
+    // The flag is per thread and may be left over from a previous document ending inside a comment
+    COMMENT_OPENED = false;
+
+    size_t line_offset = 0; // input parsed before the current line
+    bool stopped = false;
+    *error = NULL;
+
+    while(!stopped && (line = readline(stream)) != NULL) {
+        // Validated UTF-8 (or transcoded Windows-1252) from here on
+        size_t line_length = strlength(line);
+        line = normalize_line(line, &line_length, &decoder);
+
+        // We store the pointer to the whole line to be able to free it at the end
+        char *init_line_ptr = line;
+
+        while (*line) {
+            // TODO: Create a function that will free current_tag and all its children
+            HTMLTag *tag = next_tag(&line, table, error);
+            HTMLTag *completed_tag = NULL;
+
+            if (tag == NULL) {
+                break;
+            }
+            // Root opening tag
+            else if (!current_tag && is_opening_tag(tag)) {
+                trace("Found opening tag\n");
+                current_tag = tag;
+                if (stop) stop->nodes_length++;
+            }
+            // Closing tag without opening
+            else if (!current_tag && is_closing_tag(tag)) {
+                printf("Found tag: %s\n", tag->name);
+                printf("Closing tag must be preceeded with opening one\n");
+                *error = "Closing tag must be preceded with opening one";
+                free_tag(tag);
+                break;
+            }
+            // Nested opening tag
+            else if (current_tag && is_opening_tag(tag)) {
+                trace("Found opening tag\n");
+                tag->parent = current_tag;
+                current_tag = tag;
+                if (stop) stop->nodes_length++;
+            }
+            // Non-closing tag
+            else if (current_tag && is_non_closing_tag(tag)) {
+                trace("Found non-closing tag\n");
+                hash_tag(tag);
+                add_child(current_tag, tag);
+                completed_tag = tag;
+                if (stop) stop->nodes_length++;
+            }
+            // Closing tag
+            else if (current_tag && is_closing_tag(tag)) {
+                trace("Found closing tag\n");
+                trace("Current tag name: %s\n", current_tag->name);
+
+                if (open_close_tags_match(current_tag->name, tag->name)) {
+                    trace("Current opening tag and found closing tag match\n");
+                    if (current_tag->parent != NULL) {
+                        // Allocating memory for the tag pair's content  
+                        if (tag->content != NULL) {
+                            current_tag->content = strdup(tag->content); // +1 for null terminator
+
+                            if (!current_tag->content) {
+                                printf("Failed to allocate memory for tag's content\n");
+                                exit(1);
+                            }
+                        }
+
+                        // We aren't using the closing tag anywhere, so we free it
+                        free_tag(tag);
+
+                        // All children are closed (and hashed) by now, so the subtree hash is final
+                        hash_tag(current_tag);
+
+                        // Adding the tag pair to the parent tag 
+                        HTMLTag *parent = current_tag->parent;
+                        add_child(parent, current_tag);
+                        completed_tag = current_tag;
+                        current_tag = parent;
+                    }
+                    else {
+                        free_tag(tag);
+                        hash_tag(current_tag);
+                        completed_tag = current_tag;
+                    }
+                }
+                else {
+                    printf("Opening and closing tags do not match.\n");
+                    *error = "Opening and closing tags do not match";
+                    free_tag(tag);
+                    break;
+                }
+            }
+            else {
+                free_tag(tag);
+            }
+
+            if (stop != NULL) {
+                stop->bytes_parsed = line_offset + (line - init_line_ptr);
+
+                if (stop_condition_met(stop, completed_tag)) {
+                    stopped = true;
+                    break;
+                }
+            }
+        }
+
+        line_offset += line_length;
+        free(init_line_ptr);
+
+        if (*error != NULL) {
+            free_open_tags(current_tag);
+            return NULL;
+        }
+
+        // The byte budget may run out on a line without tags
+        if (stop != NULL && !stopped) {
+            stop->bytes_parsed = line_offset;
+            stopped = stop_condition_met(stop, NULL);
+        }
+    }
+
+    if (stop != NULL)
+        stop->stopped = stopped;
+
+    // Close the elements that were still open when parsing stopped
+    if (stopped && current_tag) {
+        printf("Stopped parsing early\n");
+
+        while (current_tag->parent != NULL) {
+            hash_tag(current_tag);
+
+            HTMLTag *parent = current_tag->parent;
+            add_child(parent, current_tag);
+            current_tag = parent;
+        }
+    }
+
+    // A root without closing tag hasn't been hashed yet
+    if (current_tag && current_tag->hash == 0)
+        hash_tag(current_tag);
+
+#ifdef HTML_TRACE
+    // Preview the HTML tags tree
+    if (current_tag) {
+        printf("\n\n\nHTML Preview:\n");
+        print_all_tags(current_tag, 2);
+        printf("\n\n");
+    }
+#endif
+
+    return current_tag;
+}
+
+/*
+ * Returns the slot of a string in the intern table, or of the empty slot where it would go
+ */
+int intern_find(InternTable *table, const char *str, size_t length, uint64_t hash) {
+    int mask = table->size - 1;
+    int slot = hash & mask;
+
+    while (table->strings[slot] != NULL) {
+        if (table->hashes[slot] == hash && strncmp(table->strings[slot], str, length) == 0 && table->strings[slot][length] == '\0')
+            return slot;
+
+        slot = (slot + 1) & mask;
+    }
+
+    return slot;
+}
+
+/*
+ * Doubles the intern table (or creates it), rehashing the stored strings
+ * The strings themselves stay where they are in the arena
+ */
+void intern_grow(InternTable *table) {
+    const char **old_strings = table->strings;
+    uint64_t *old_hashes = table->hashes;
+    int old_size = table->size;
+
+    table->size = old_size ? old_size * 2 : INTERN_TABLE_INITIAL_SIZE;
+    table->strings = (const char**) calloc(table->size, sizeof(char*));
+    table->hashes = (uint64_t*) calloc(table->size, sizeof(uint64_t));
+
+    if (table->strings == NULL || table->hashes == NULL) {
+        perror("Failed to allocate memory for the intern table");
+        exit(1);
+    }
+
+    for (int i = 0; i < old_size; i++) {
+        if (old_strings[i] != NULL) {
+            int slot = old_hashes[i] & (table->size - 1);
+            while (table->strings[slot] != NULL)
+                slot = (slot + 1) & (table->size - 1);
+
+            table->strings[slot] = old_strings[i];
+            table->hashes[slot] = old_hashes[i];
+        }
+    }
+
+    free(old_strings);
+    free(old_hashes);
+}
+
+/*
+ * Copies a string into the arena and returns the copy
+ * Chunks are kept until intern_table_free(), interned strings live as long as the session
+ */
+const char *intern_arena_copy(InternTable *table, const char *str, size_t length) {
+    if (table->arena == NULL || table->arena_used + length + 1 > table->arena_size) {
+        if (table->chunks_length == table->chunks_size) {
+            table->chunks_size = table->chunks_size ? table->chunks_size * 2 : 16;
+            table->chunks = (char**) realloc(table->chunks, table->chunks_size * sizeof(char*));
+
+            if (table->chunks == NULL) {
+                perror("Failed to allocate memory for the intern arena");
+                exit(1);
+            }
+        }
+
+        // Strings bigger than a chunk get a chunk of their own
+        table->arena_size = length + 1 > INTERN_ARENA_CHUNK_SIZE ? length + 1 : INTERN_ARENA_CHUNK_SIZE;
+        table->arena = (char*) malloc(table->arena_size);
+        table->arena_used = 0;
+
+        if (table->arena == NULL) {
+            perror("Failed to allocate memory for the intern arena");
+            exit(1);
+        }
+
+        table->chunks[table->chunks_length++] = table->arena;
+    }
+
+    char *copy = table->arena + table->arena_used;
+    memcpy(copy, str, length + 1);
+    table->arena_used += length + 1;
+    table->bytes_stored += length + 1;
+
+    return copy;
+}
+
+/*
+ * Returns the interned copy of a string: equal strings always give the same pointer,
+ * so they can be compared with == and are stored only once
+ * E.g. intern_string("class") == intern_string("class")
+ */
+const char *intern_string(InternTable *table, const char *str) {
+    size_t length = strlength(str);
+    uint64_t hash = hash_bytes(FNV_OFFSET_BASIS, str, length);
+
+    table->lookups++;
+    table->bytes_requested += length + 1;
+
+    if ((table->length + 1) * 2 > table->size)
+        intern_grow(table);
+
+    int slot = intern_find(table, str, length, hash);
+    if (table->strings[slot] == NULL) {
+        table->strings[slot] = intern_arena_copy(table, str, length);
+        table->hashes[slot] = hash;
+        table->length++;
+    }
+
+    return table->strings[slot];
+}
+
+/*
+ * Initializes an empty intern table, the slots and the arena are allocated on the first insert
+ */
+void intern_table_init(InternTable *table) {
+    memset(table, 0, sizeof(InternTable));
+}
+
+/*
+ * Frees the strings of a table, every pointer intern_string() returned from it becomes invalid
+ */
+void intern_table_free(InternTable *table) {
+    for (int i = 0; i < table->chunks_length; i++)
+        free(table->chunks[i]);
+
+    free(table->chunks);
+    free(table->strings);
+    free(table->hashes);
+}
+
+/*
+ * Adds the counters of a table to stats, E.g. when a batch worker is done with its table
+ */
+void intern_stats_add(InternStats *stats, InternTable *table) {
+    stats->lookups += table->lookups;
+    stats->bytes_requested += table->bytes_requested;
+    stats->bytes_stored += table->bytes_stored;
+    stats->distinct += table->length;
+}
+
+/*
+ * Prints how much memory interning saved, nothing if there were no lookups
+ * E.g. indent "  " lines it up with the batch summary
+ */
+void print_intern_report(InternStats *stats, const char *indent) {
+    if (stats->lookups == 0)
+        return;
+
+    printf("%sInterned strings: %zu lookups, %d distinct, %zu bytes stored for %zu bytes requested (dedup ratio %.1fx)\n",
+           indent, stats->lookups, stats->distinct, stats->bytes_stored, stats->bytes_requested,
+           stats->bytes_stored ? (double) stats->bytes_requested / stats->bytes_stored : 0.0);
+}
+
+/*
+ * Feeds bytes into a 64-bit FNV-1a hash
+ */
+uint64_t hash_bytes(uint64_t hash, const void *data, size_t length) {
+    const unsigned char *bytes = (const unsigned char*) data;
+
+    for (size_t i = 0; i < length; i++) {
+        hash ^= bytes[i];
+        hash *= FNV_PRIME;
+    }
+
+    return hash;
+}
+
+/*
+ * Feeds a string into a hash, including its terminator so that "ab" + "c" differs from "a" + "bc"
+ * NULL is hashed differently from an empty string
+ */
+uint64_t hash_string(uint64_t hash, const char *str) {
+    if (str == NULL)
+        return hash_bytes(hash, "\xFF", 1);
+
+    return hash_bytes(hash, str, strlength(str) + 1);
+}
+
+/*
+ * Computes the Merkle hash of a tag from its name, attributes, content and its children's hashes
+ * Children must be hashed already, which parse_tags() guarantees by hashing each element as it closes
+ * Equal hashes mean (with overwhelming probability) identical subtrees
+ */
+uint64_t hash_tag(HTMLTag *tag) {
+    uint64_t hash = FNV_OFFSET_BASIS;
+
+    hash = hash_string(hash, tag->name);
+    hash = hash_bytes(hash, &tag->attribute_length, sizeof(tag->attribute_length));
+
+    for (int i = 0; i < tag->attribute_length; i++) {
+        Attribute *attr = *(tag->attributes + i);
+        hash = hash_string(hash, attr->name);
+        hash = hash_string(hash, attr->value);
+    }
+
+    hash = hash_string(hash, tag->content);
+    hash = hash_bytes(hash, &tag->children_length, sizeof(tag->children_length));
+    tag->subtree_size = 1;
+
+    for (int i = 0; i < tag->children_length; i++) {
+        HTMLTag *child = *(tag->children + i);
+        hash = hash_bytes(hash, &child->hash, sizeof(child->hash));
+        tag->subtree_size += child->subtree_size;
+    }
+
+    // 0 means "not hashed yet"
+    if (hash == 0)
+        hash = 1;
+
+    tag->hash = hash;
+    return hash;
+}
+
+/*
+ * Returns a newly allocated path of a child, e.g. child_path("/0/2", 1) => "/0/2/1"
+ */
+char *child_path(const char *path, int index) {
+    size_t length = strlength(path) + 16;
+    char *result = (char*) calloc(length, sizeof(char));
+
+    if (result == NULL) {
+        perror("Failed to allocate memory for the diff path");
+        exit(1);
+    }
+
+    snprintf(result, length, "%s/%d", path, index);
+    return result;
+}
+
+/*
+ * Creates an edit object of the edit script, e.g. {"op": "delete", "path": "/0/1"}
+ */
+json_object *json_create_edit(const char *op, const char *path) {
+    json_object *edit = json_object_new_object();
+    json_object_object_add(edit, "op", json_object_new_string(op));
+    json_object_object_add(edit, "path", json_object_new_string(path));
+    return edit;
+}
+
+/*
+ * Emits update_attribute edits for attributes that were changed, added (old is null) or removed (value is null)
+ */
+void diff_attributes(HTMLTag *old_tag, HTMLTag *new_tag, const char *path, json_object *edits) {
+    for (int i = 0; i < new_tag->attribute_length; i++) {
+        Attribute *new_attr = *(new_tag->attributes + i);
+        Attribute *old_attr = NULL;
+
+        for (int j = 0; j < old_tag->attribute_length; j++) {
+            // Interned names are equal only if they're the same pointer
+            if ((*(old_tag->attributes + j))->name == new_attr->name) {
+                old_attr = *(old_tag->attributes + j);
+                break;
+            }
+        }
+
+        if (old_attr == NULL || !strequals(old_attr->value, new_attr->value)) {
+            json_object *edit = json_create_edit("update_attribute", path);
+            json_object_object_add(edit, "name", json_object_new_string(new_attr->name));
+            json_object_object_add(edit, "old", old_attr ? json_object_new_string(old_attr->value) : NULL);
+            json_object_object_add(edit, "value", json_object_new_string(new_attr->value));
+            json_object_array_add(edits, edit);
+        }
+    }
+
+    for (int i = 0; i < old_tag->attribute_length; i++) {
+        Attribute *old_attr = *(old_tag->attributes + i);
+        bool removed = true;
+
+        for (int j = 0; j < new_tag->attribute_length; j++) {
+            if ((*(new_tag->attributes + j))->name == old_attr->name) {
+                removed = false;
+                break;
+            }
+        }
+
+        if (removed) {
+            json_object *edit = json_create_edit("update_attribute", path);
+            json_object_object_add(edit, "name", json_object_new_string(old_attr->name));
+            json_object_object_add(edit, "old", json_object_new_string(old_attr->value));
+            json_object_object_add(edit, "value", NULL);
+            json_object_array_add(edits, edit);
+        }
+    }
+}
+
+/*
+ * Aligns two lists of children and emits insert/delete edits or recurses into changed children
+ * Identical children are matched by hash, so unchanged runs cost one comparison per child
+ * position is the index of the current child in the list as edited so far: inserts, kept and
+ * changed children move it forward, deletes don't
+ * E.g. old [a, b, div], new [p, a, div'] => insert /0/0, delete /0/2, then div's edits under /0/2
+ */
+void diff_children(HTMLTag *old_tag, HTMLTag *new_tag, const char *path, json_object *edits) {
+    HTMLTag **old_children = old_tag->children;
+    HTMLTag **new_children = new_tag->children;
+    int old_end = old_tag->children_length;
+    int new_end = new_tag->children_length;
+    int i = 0, j = 0;
+    int position = 0;
+
+    // Skip the common suffix, the common prefix is skipped by the loop below
+    while (old_end > 0 && new_end > 0 && old_children[old_end - 1]->hash == new_children[new_end - 1]->hash) {
+        old_end--;
+        new_end--;
+    }
+
+    while (i < old_end || j < new_end) {
+        if (i < old_end && j < new_end && old_children[i]->hash == new_children[j]->hash) {
+            i++;
+            j++;
+            position++;
+            continue;
+        }
+
+        // Look ahead for the current children to decide between an insertion, a deletion and a change
+        bool old_found_later = false;
+        bool new_found_later = false;
+
+        for (int k = j + 1; i < old_end && k < new_end && !old_found_later; k++)
+            old_found_later = new_children[k]->hash == old_children[i]->hash;
+
+        for (int k = i + 1; j < new_end && k < old_end && !new_found_later; k++)
+            new_found_later = old_children[k]->hash == new_children[j]->hash;
+
+        char *current_path = child_path(path, position);
+
+        if (j < new_end && (i == old_end || (old_found_later && !new_found_later))) {
+            json_object *edit = json_create_edit("insert", current_path);
+            json_object_object_add(edit, "tag", json_create_subtree(new_children[j]));
+            json_object_array_add(edits, edit);
+            j++;
+            position++;
+        }
+        else if (i < old_end && (j == new_end || new_found_later || !strequals(old_children[i]->name, new_children[j]->name))) {
+            // The next old child moves into this position
+            json_object_array_add(edits, json_create_edit("delete", current_path));
+            i++;
+        }
+        else {
+            // Same kind of element at the same position: describe what changed inside
+            diff_tags(old_children[i], new_children[j], current_path, edits);
+            i++;
+            j++;
+            position++;
+        }
+
+        free(current_path);
+    }
+}
+
+/*
+ * Appends the edits turning old_tag into new_tag to edits
+ * Paths are child indices from the root in the tree as it is when the edit is applied,
+ * so applying the edits in order turns the old tree into the new one
+ */
+void diff_tags(HTMLTag *old_tag, HTMLTag *new_tag, const char *path, json_object *edits) {
+    // Identical subtrees are skipped without looking inside
+    if (old_tag->hash == new_tag->hash)
+        return;
+
+    if (!strequals(old_tag->name, new_tag->name)) {
+        json_object_array_add(edits, json_create_edit("delete", path));
+
+        json_object *edit = json_create_edit("insert", path);
+        json_object_object_add(edit, "tag", json_create_subtree(new_tag));
+        json_object_array_add(edits, edit);
+        return;
+    }
+
+    diff_attributes(old_tag, new_tag, path, edits);
+
+    bool same_content = (old_tag->content == NULL && new_tag->content == NULL) ||
+                        (old_tag->content && new_tag->content && strequals(old_tag->content, new_tag->content));
+
+    if (!same_content) {
+        json_object *edit = json_create_edit("update_text", path);
+        json_object_object_add(edit, "old", old_tag->content ? json_object_new_string(old_tag->content) : NULL);
+        json_object_object_add(edit, "value", new_tag->content ? json_object_new_string(new_tag->content) : NULL);
+        json_object_array_add(edits, edit);
+    }
+
+    diff_children(old_tag, new_tag, path, edits);
+}
+
+/*
+ * Parses two HTML files and saves the edit script between them as JSON
+ */
+int diff_files(const char *old_filename, const char *new_filename, const char *json_filename) {
+    Decompressor *old_decompressor;
+    Decompressor *new_decompressor;
+    FILE *old_stream = open_file(old_filename, &old_decompressor);
+    FILE *new_stream = open_file(new_filename, &new_decompressor);
+
+    if (!old_stream || !new_stream) {
+        if (old_stream) close_file(old_stream, old_decompressor);
+        if (new_stream) close_file(new_stream, new_decompressor);
+        return 1;
+    }
+
+    // One table for both trees, so that equal attributes are the same pointer in both
+    InternTable table;
+    intern_table_init(&table);
+
+    const char *old_error;
+    const char *new_error;
+    HTMLTag *old_root = parse_tags(old_stream, &table, &old_error);
+    HTMLTag *new_root = parse_tags(new_stream, &table, &new_error);
+
+    bool old_ok = close_file(old_stream, old_decompressor);
+    bool new_ok = close_file(new_stream, new_decompressor);
+
+    if (old_error || new_error || !old_ok || !new_ok) {
+        if (old_error || new_error)
+            printf("Failed to parse %s: %s\n", old_error ? old_filename : new_filename, old_error ? old_error : new_error);
+        else
+            printf("Failed to read %s\n", !old_ok ? old_filename : new_filename);
+
+        if (old_root) free_tag(old_root);
+        if (new_root) free_tag(new_root);
+        intern_table_free(&table);
+        return 1;
+    }
+
+    json_object *edits = json_object_new_array();
+
+    double start = now();
+
+    if (old_root && new_root) {
+        diff_tags(old_root, new_root, "/0", edits);
+    }
+    else if (new_root) {
+        json_object *edit = json_create_edit("insert", "/0");
+        json_object_object_add(edit, "tag", json_create_subtree(new_root));
+        json_object_array_add(edits, edit);
+    }
+    else if (old_root) {
+        json_object_array_add(edits, json_create_edit("delete", "/0"));
+    }
+
+    double elapsed = now() - start;
+    int edits_length = json_object_array_length(edits);
+
+    if (json_object_to_file_ext(json_filename, edits, JSON_OUTPUT_FLAGS)) {
+        printf("Failed to save edit script to %s\n", json_filename);
+    }
+    else {
+        printf("Saved %d edit(s) to %s (diffed in %.1f us)\n", edits_length, json_filename, elapsed * 1e6);
+    }
+
+    json_object_put(edits);
+    if (old_root) free_tag(old_root);
+    if (new_root) free_tag(new_root);
+    intern_table_free(&table);
+
+    return 0;
+}
+
+/*
+ * Formats the content-addressed ID of a subtree (16 hex digits) into id, which must hold 17 chars
+ */
+void subtree_id(uint64_t hash, char *id) {
+    snprintf(id, 17, "%016llx", (unsigned long long) hash);
+}
+
+/*
+ * Returns the slot of a hash in the store, or of the empty slot where it would go
+ */
+int subtree_store_find(SubtreeStore *store, uint64_t hash) {
+    int mask = store->size - 1;
+    int slot = hash & mask;
+
+    while (store->hashes[slot] != 0 && store->hashes[slot] != hash)
+        slot = (slot + 1) & mask;
+
+    return slot;
+}
+
+/*
+ * Adds a hash (without subtree yet) to the store, growing it at half load, and returns its slot
+ */
+int subtree_store_insert(SubtreeStore *store, uint64_t hash) {
+    if ((store->length + 1) * 2 > store->size) {
+        uint64_t *old_hashes = store->hashes;
+        json_object **old_subtrees = store->subtrees;
+        int old_size = store->size;
+
+        store->size = old_size * 2;
+        store->hashes = (uint64_t*) calloc(store->size, sizeof(uint64_t));
+        store->subtrees = (json_object**) calloc(store->size, sizeof(json_object*));
+
+        if (store->hashes == NULL || store->subtrees == NULL) {
+            perror("Failed to allocate memory for the subtree store");
+            exit(1);
+        }
+
+        for (int i = 0; i < old_size; i++) {
+            if (old_hashes[i] != 0) {
+                int slot = subtree_store_find(store, old_hashes[i]);
+                store->hashes[slot] = old_hashes[i];
+                store->subtrees[slot] = old_subtrees[i];
+            }
+        }
+
+        free(old_hashes);
+        free(old_subtrees);
+    }
+
+    int slot = subtree_store_find(store, hash);
+    if (store->hashes[slot] == 0) {
+        store->hashes[slot] = hash;
+        store->length++;
+    }
+
+    return slot;
+}
+
+/*
+ * Loads a subtree store saved by subtree_store_save(), or creates an empty one if the file doesn't exist
+ * The file is {"seen": [id, ...], "subtrees": [{"id": id, "tag": {...}}, ...]}
+ */
+SubtreeStore *subtree_store_load(const char *store_filename) {
+    SubtreeStore *store = (SubtreeStore*) calloc(1, sizeof(SubtreeStore));
+
+    if (store == NULL) {
+        perror("Failed to allocate memory for the subtree store");
+        exit(1);
+    }
+
+    pthread_mutex_init(&store->lock, NULL);
+    store->size = DEDUP_STORE_INITIAL_SIZE;
+    store->hashes = (uint64_t*) calloc(store->size, sizeof(uint64_t));
+    store->subtrees = (json_object**) calloc(store->size, sizeof(json_object*));
+
+    if (store->hashes == NULL || store->subtrees == NULL) {
+        perror("Failed to allocate memory for the subtree store");
+        exit(1);
+    }
+
+    if (access(store_filename, F_OK) != 0)
+        return store;
+
+    json_object *json_store = json_object_from_file(store_filename);
+    json_object *seen = NULL;
+    json_object *subtrees = NULL;
+
+    if (json_store == NULL || !json_object_object_get_ex(json_store, "seen", &seen) ||
+        !json_object_object_get_ex(json_store, "subtrees", &subtrees)) {
+        printf("Invalid subtree store: %s\n", store_filename);
+        exit(1);
+    }
+
+    for (size_t i = 0; i < json_object_array_length(seen); i++) {
+        const char *id = json_object_get_string(json_object_array_get_idx(seen, i));
+        subtree_store_insert(store, strtoull(id, NULL, 16));
+    }
+
+    for (size_t i = 0; i < json_object_array_length(subtrees); i++) {
+        json_object *entry = json_object_array_get_idx(subtrees, i);
+        json_object *id = NULL;
+        json_object *tag = NULL;
+
+        if (!json_object_object_get_ex(entry, "id", &id) || !json_object_object_get_ex(entry, "tag", &tag)) {
+            printf("Invalid subtree store entry in %s\n", store_filename);
+            exit(1);
+        }
+
+        int slot = subtree_store_insert(store, strtoull(json_object_get_string(id), NULL, 16));
+        store->subtrees[slot] = json_object_get(tag);
+        store->stored++;
+    }
+
+    json_object_put(json_store);
+
+    return store;
+}
+
+/*
+ * Saves the store so that later batches keep referencing the same subtrees
+ */
+bool subtree_store_save(SubtreeStore *store, const char *store_filename) {
+    json_object *json_store = json_object_new_object();
+    json_object *seen = json_object_new_array();
+    json_object *subtrees = json_object_new_array();
+    char id[17];
+
+    for (int i = 0; i < store->size; i++) {
+        if (store->hashes[i] == 0)
+            continue;
+
+        subtree_id(store->hashes[i], id);
+
+        if (store->subtrees[i] == NULL) {
+            json_object_array_add(seen, json_object_new_string(id));
+        }
+        else {
+            json_object *entry = json_object_new_object();
+            json_object_object_add(entry, "id", json_object_new_string(id));
+            json_object_object_add(entry, "tag", json_object_get(store->subtrees[i]));
+            json_object_array_add(subtrees, entry);
+        }
+    }
+
+    json_object_object_add(json_store, "seen", seen);
+    json_object_object_add(json_store, "subtrees", subtrees);
+
+    bool ok = json_object_to_file_ext(store_filename, json_store, JSON_OUTPUT_FLAGS) == 0;
+    json_object_put(json_store);
+
+    return ok;
+}
+
+/*
+ * Frees the store and the subtrees it holds
+ */
+void subtree_store_free(SubtreeStore *store) {
+    for (int i = 0; i < store->size; i++) {
+        if (store->subtrees[i] != NULL)
+            json_object_put(store->subtrees[i]);
+    }
+
+    pthread_mutex_destroy(&store->lock);
+    free(store->hashes);
+    free(store->subtrees);
+    free(store);
+}
+
+/*
+ * Returns the subtree stored under a hash, or NULL if it has been seen only once (or never)
+ * Stored subtrees aren't modified or freed until the store is, so the pointer stays valid without the lock
+ */
+json_object *subtree_store_get(SubtreeStore *store, uint64_t hash) {
+    pthread_mutex_lock(&store->lock);
+    json_object *subtree = store->subtrees[subtree_store_find(store, hash)];
+    pthread_mutex_unlock(&store->lock);
+
+    return subtree;
+}
+
+/*
+ * Returns true if a json string (which may be missing) equals str
+ */
+bool json_string_equals(json_object *json_str, const char *str) {
+    const char *value = json_object_get_string(json_str);
+    return value != NULL && strequals(value, str);
+}
+
+/*
+ * Checks that a stored subtree is exactly the subtree of tag, following references into the store
+ * The hash only finds the candidate; a 64-bit collision (or a crafted page) must not swap a subtree for another one
+ * Costs one walk over the subtree without allocating, which is still much cheaper than serializing it
+ */
+bool subtree_matches(HTMLTag *tag, json_object *json_tag, SubtreeStore *store) {
+    json_object *field = NULL;
+
+    if (json_object_object_get_ex(json_tag, "ref", &field)) {
+        json_tag = subtree_store_get(store, strtoull(json_object_get_string(field), NULL, 16));
+        if (json_tag == NULL)
+            return false;
+    }
+
+    if (!json_object_object_get_ex(json_tag, "name", &field) || !json_string_equals(field, tag->name))
+        return false;
+
+    bool has_content = json_object_object_get_ex(json_tag, "content", &field);
+    if (has_content != (tag->content != NULL) || (has_content && !json_string_equals(field, tag->content)))
+        return false;
+
+    json_object *attributes = NULL;
+    int attribute_length = json_object_object_get_ex(json_tag, "attributes", &attributes) ? (int) json_object_array_length(attributes) : 0;
+    if (attribute_length != tag->attribute_length)
+        return false;
+
+    for (int i = 0; i < attribute_length; i++) {
+        Attribute *attr = *(tag->attributes + i);
+        json_object *json_attr = json_object_array_get_idx(attributes, i);
+
+        if (!json_object_object_get_ex(json_attr, "name", &field) || !json_string_equals(field, attr->name))
+            return false;
+
+        if (!json_object_object_get_ex(json_attr, "value", &field) || !json_string_equals(field, attr->value))
+            return false;
+    }
+
+    json_object *children = NULL;
+    int children_length = json_object_object_get_ex(json_tag, "children", &children) ? (int) json_object_array_length(children) : 0;
+    if (children_length != tag->children_length)
+        return false;
+
+    for (int i = 0; i < children_length; i++) {
+        if (!subtree_matches(*(tag->children + i), json_object_array_get_idx(children, i), store))
+            return false;
+    }
+
+    return true;
+}
+
+/*
+ * Creates {"ref": id} for a stored subtree and counts it
+ */
+json_object *json_create_subtree_reference(SubtreeStore *store, uint64_t hash) {
+    char id[17];
+
+    pthread_mutex_lock(&store->lock);
+    store->references++;
+    pthread_mutex_unlock(&store->lock);
+
+    subtree_id(hash, id);
+    json_object *ref = json_object_new_object();
+    json_object_object_add(ref, "ref", json_object_new_string(id));
+    return ref;
+}
+
+/*
+ * Creates a json object of a HTMLTag like json_create_subtree(), but replaces repeated subtrees
+ * with {"ref": id} pointing into the store
+ * A subtree goes into the store the second time it's seen (in any document of the batch), so the store
+ * only holds boilerplate and documents stay self-contained until something actually repeats
+ * Referenced subtrees are compared against the stored one but never serialized
+ */
+json_object *json_create_deduplicated_subtree(HTMLTag *tag, SubtreeStore *store) {
+    bool seen_before = false;
+
+    if (tag->subtree_size >= DEDUP_MIN_NODES) {
+        pthread_mutex_lock(&store->lock);
+
+        int slot = subtree_store_find(store, tag->hash);
+        json_object *stored = store->subtrees[slot];
+        seen_before = store->hashes[slot] != 0;
+
+        if (!seen_before)
+            subtree_store_insert(store, tag->hash);
+
+        pthread_mutex_unlock(&store->lock);
+
+        if (stored != NULL) {
+            if (subtree_matches(tag, stored, store))
+                return json_create_subtree_reference(store, tag->hash);
+
+            // Same hash, different subtree: this one stays inline
+            pthread_mutex_lock(&store->lock);
+            store->collisions++;
+            pthread_mutex_unlock(&store->lock);
+            seen_before = false;
+        }
+    }
+
+    json_object *json_tag = json_create_tag(tag);
+
+    if (tag->children_length > 0) {
+        json_object *children = json_object_new_array();
+
+        for (int i = 0; i < tag->children_length; i++) {
+            json_object_array_add(children, json_create_deduplicated_subtree(*(tag->children + i), store));
+        }
+
+        json_object_object_add(json_tag, "children", children);
+    }
+
+    if (!seen_before)
+        return json_tag;
+
+    // Second sighting: the store takes the subtree over and this occurrence becomes a reference too
+    pthread_mutex_lock(&store->lock);
+
+    int slot = subtree_store_find(store, tag->hash);
+    json_object *stored = store->subtrees[slot];
+
+    if (stored == NULL) {
+        store->subtrees[slot] = json_tag;
+        store->stored++;
+    }
+
+    pthread_mutex_unlock(&store->lock);
+
+    if (stored == NULL)
+        return json_create_subtree_reference(store, tag->hash);
+
+    // Another thread stored it first
+    if (subtree_matches(tag, stored, store)) {
+        json_object_put(json_tag);
+        return json_create_subtree_reference(store, tag->hash);
+    }
+
+    pthread_mutex_lock(&store->lock);
+    store->collisions++;
+    pthread_mutex_unlock(&store->lock);
+
+    return json_tag;
+}
+
+/*
+ * Replaces {"ref": id} objects in an array of tags (and all their children) with the subtrees from the store
+ */
+void expand_references(json_object *tags, SubtreeStore *store) {
+    for (size_t i = 0; i < json_object_array_length(tags); i++) {
+        json_object *tag = json_object_array_get_idx(tags, i);
+        json_object *ref = NULL;
+        json_object *children = NULL;
+
+        if (json_object_object_get_ex(tag, "ref", &ref)) {
+            int slot = subtree_store_find(store, strtoull(json_object_get_string(ref), NULL, 16));
+
+            if (store->subtrees[slot] == NULL) {
+                printf("Unknown subtree reference: %s\n", json_object_get_string(ref));
+                exit(1);
+            }
+
+            // Shared with the store; json-c reference counts it
+            tag = json_object_get(store->subtrees[slot]);
+            json_object_array_put_idx(tags, i, tag);
+        }
+
+        // Stored subtrees may reference other stored subtrees
+        if (json_object_object_get_ex(tag, "children", &children))
+            expand_references(children, store);
+    }
+}
+
+/*
+ * Expands a deduplicated JSON output back into the full representation
+ */
+int expand_file(const char *store_filename, const char *json_filename, const char *output_filename) {
+    SubtreeStore *store = subtree_store_load(store_filename);
+    json_object *tags = json_object_from_file(json_filename);
+
+    if (tags == NULL) {
+        printf("Failed to read JSON from %s\n", json_filename);
+        subtree_store_free(store);
+        return 1;
+    }
+
+    expand_references(tags, store);
+
+    int ret = 0;
+    if (json_object_to_file_ext(output_filename, tags, JSON_OUTPUT_FLAGS)) {
+        printf("Failed to save JSON to %s\n", output_filename);
+        ret = 1;
+    }
+    else {
+        printf("Saved expanded JSON representation to %s\n", output_filename);
+    }
+
+    json_object_put(tags);
+    subtree_store_free(store);
+
+    return ret;
+}
+
+/*
+ * Writes a run of text with whitespace collapsed and character references decoded
+ * Whitespace at the run's edges is kept as a pending separator, so runs split by tags join correctly
+ */
+void text_emit_run(TextExtractor *ex, const char *start, const char *end) {
+    size_t length = end - start;
+    size_t offset = 0;
+
+    if (length + 3 > ex->scratch_size) {
+        ex->scratch_size = (length + 3) * 2;
+        ex->scratch = (char*) realloc(ex->scratch, ex->scratch_size);
+
+        if (ex->scratch == NULL) {
+            perror("Failed to reallocate memory for the text buffer");
+            exit(1);
+        }
+    }
+
+    const char *s = start;
+
+    while (s < end) {
+        // Whitespace collapses into a single pending separator
+        if (text_whitespace_chars[(unsigned char) *s]) {
+            if (ex->pending == 0)
+                ex->pending = ' ';
+            s++;
+            continue;
+        }
+
+        if (ex->pending) {
+            if (!ex->at_start)
+                ex->scratch[offset++] = ex->pending;
+            ex->pending = 0;
+        }
+
+        // Copy the word, the loop only looks up whether each byte is whitespace
+        char *out = ex->scratch + offset;
+        const char *word = s;
+        while (s < end && !text_whitespace_chars[(unsigned char) *s])
+            *out++ = *s++;
+
+        offset += s - word;
+        ex->at_start = false;
+    }
+
+    if (offset == 0)
+        return;
+
+    ex->scratch[offset] = '\0';
+    char *text = ex->scratch;
+
+    // The decode buffer is reused across runs like scratch
+    if (memchr(ex->scratch, '&', offset) != NULL) {
+        if (MAX_DECODED_LENGTH(offset) > ex->decoded_size) {
+            ex->decoded_size = MAX_DECODED_LENGTH(offset) * 2;
+            ex->decoded = (char*) realloc(ex->decoded, ex->decoded_size);
+
+            if (ex->decoded == NULL) {
+                perror("Failed to reallocate memory for the text buffer");
+                exit(1);
+            }
+        }
+
+        offset = decode_entities_into(ex->scratch, offset, ex->decoded, false);
+        text = ex->decoded;
+    }
+
+    fwrite_unlocked(text, 1, offset, ex->out);
+    ex->bytes_out += offset;
+}
+
+/*
+ * Handles the end of a tag: block tags become separators, <script> and <style> switch to raw text
+ */
+void text_end_tag(TextExtractor *ex) {
+    char *name = ex->tag_name;
+
+    ex->tag_name[ex->tag_name_length] = '\0';
+    ex->state = TEXT_STATE_TEXT;
+
+    if (bsearch(&name, block_tags, BLOCK_TAGS_LEN, sizeof(char*), compare_strings))
+        ex->pending = ex->boundaries ? '\n' : (ex->pending ? ex->pending : ' ');
+
+    if (!ex->tag_closing) {
+        if (strequals(ex->tag_name, "script")) {
+            ex->state = TEXT_STATE_RAW_TEXT;
+            ex->raw_text_end = "</script";
+        }
+        else if (strequals(ex->tag_name, "style")) {
+            ex->state = TEXT_STATE_RAW_TEXT;
+            ex->raw_text_end = "</style";
+        }
+    }
+}
+
+/*
+ * Extracts the text of a line, continuing from the state the previous line ended in
+ * (tags, comments and scripts can span lines)
+ */
+void text_extract_line(TextExtractor *ex, char *line, size_t length) {
+    char *p = line;
+    char *end = line + length;
+
+    while (p < end) {
+        if (ex->state == TEXT_STATE_TEXT) {
+            // Text runs are found with memchr, only tags are looked at byte by byte
+            // Like in HTML, '<' only starts a tag when followed by '/', '!' or a letter, e.g. "if a < b" is text
+            char *tag_start = p;
+            while ((tag_start = memchr(tag_start, '<', end - tag_start)) != NULL &&
+                   !(tag_start + 1 < end && (tag_start[1] == '/' || tag_start[1] == '!' || isalpha((unsigned char) tag_start[1]))))
+                tag_start++;
+
+            text_emit_run(ex, p, tag_start ? tag_start : end);
+
+            if (tag_start == NULL)
+                return;
+
+            p = tag_start + 1;
+
+            if (end - p >= 3 && memcmp(p, "!--", 3) == 0) {
+                ex->state = TEXT_STATE_COMMENT;
+                p += 3;
+                continue;
+            }
+
+            ex->state = TEXT_STATE_TAG;
+            ex->tag_name_length = 0;
+            ex->tag_name_done = false;
+            ex->tag_closing = false;
+            ex->quote = 0;
+        }
+        else if (ex->state == TEXT_STATE_TAG) {
+            char c = *p++;
+
+            if (ex->quote) {
+                if (c == ex->quote)
+                    ex->quote = 0;
+            }
+            else if (c == '>') {
+                text_end_tag(ex);
+            }
+            else if (!ex->tag_name_done) {
+                if (c == '/' && ex->tag_name_length == 0 && !ex->tag_closing)
+                    ex->tag_closing = true;
+                else if (isalnum((unsigned char) c) && ex->tag_name_length < (int) sizeof(ex->tag_name) - 1)
+                    ex->tag_name[ex->tag_name_length++] = tolower((unsigned char) c);
+                else
+                    ex->tag_name_done = true;
+            }
+            else if (c == '"' || c == '\'') {
+                ex->quote = c;
+            }
+            else {
+                // Past the name only quotes and the closing arrow matter, so skip to the next one
+                char *next = strpbrk(p, ">\"'");
+                p = next ? next : end;
+            }
+        }
+        else if (ex->state == TEXT_STATE_COMMENT) {
+            char *comment_end = memmem(p, end - p, "-->", 3);
+            if (comment_end == NULL)
+                return;
+
+            p = comment_end + 3;
+            ex->state = TEXT_STATE_TEXT;
+        }
+        else {
+            // Raw text ends at the matching closing tag, which is then handled like any tag
+            char *raw_end = strcasestr(p, ex->raw_text_end);
+            if (raw_end == NULL)
+                return;
+
+            p = raw_end + 2;
+            ex->state = TEXT_STATE_TAG;
+            ex->tag_name_length = 0;
+            ex->tag_name_done = false;
+            ex->tag_closing = true;
+            ex->quote = 0;
+        }
+    }
+}
+
+/*
+ * Streams the visible text of an HTML file in document order, without building any tags
+ * Comments, <script> and <style> are skipped, whitespace is collapsed and
+ * block elements separate text (by newlines when boundaries is set)
+ */
+int extract_text(const char *html_filename, const char *text_filename, bool boundaries) {
+    Decompressor *decompressor;
+    FILE *stream = open_file(html_filename, &decompressor);
+    if (!stream) return 1;
+
+    FILE *out = fopen(text_filename, "w");
+    if (!out) {
+        perror("Failed to open output file");
+        close_file(stream, decompressor);
+        return 1;
+    }
+
+    setvbuf(out, NULL, _IOFBF, TEXT_OUTPUT_BUFFER_SIZE);
+
+    TextExtractor ex = { 0 };
+    ex.out = out;
+    ex.state = TEXT_STATE_TEXT;
+    ex.boundaries = boundaries;
+    ex.at_start = true;
+
+    char *line = NULL;
+    size_t line_size = 0;
+    ssize_t length;
+    size_t bytes_in = 0;
+    LineDecoder decoder = { .first_line = true };
+    double start = now();
+
+    // getline finds line ends with memchr, unlike readline() which goes through fgetc
+    while ((length = getline(&line, &line_size, stream)) > 0) {
+        bytes_in += length;
+
+        // Same encoding handling as parse_tags(), so the output is always UTF-8
+        size_t line_length = length;
+        char *normalized = normalize_line(line, &line_length, &decoder);
+
+        if (normalized != line) {
+            line = normalized;
+            line_size = line_length + 1;
+        }
+
+        // The length changes even for the same buffer when a BOM was stripped
+        text_extract_line(&ex, line, line_length);
+    }
+
+    if (!ex.at_start)
+        fputc('\n', out);
+
+    double elapsed = now() - start;
+    printf("Extracted %zu bytes of text from %zu bytes of HTML in %.3f s (%.1f MB/s)\n",
+           ex.bytes_out, bytes_in, elapsed, elapsed > 0 ? bytes_in / elapsed / 1e6 : 0.0);
+
+    free(line);
+    free(ex.scratch);
+    free(ex.decoded);
+    fclose(out);
+
+    // The text is streamed out as it's decoded, so a truncated input still fails the run
+    if (!close_file(stream, decompressor)) {
+        printf("Failed to read %s, %s is incomplete\n", html_filename, text_filename);
+        return 1;
+    }
+
+    return 0;
+}
+
+/*
+ * Creates an array of attribute objects and returns the pointer to the json object
+ */
+json_object *json_create_attributes_array(Attribute **attrs, int attrs_length) {
+    json_object *json_attrs = json_object_new_array();
+
+    for (int i = 0; i < attrs_length; i++) {
+        Attribute *attr = *(attrs + i);
+
+        json_object *json_attr = json_object_new_object();
+        json_object_object_add(json_attr, "name", json_object_new_string(attr->name));
+        json_object_object_add(json_attr, "value", json_object_new_string(attr->value));
+
+        json_object_array_add(json_attrs, json_attr);
+    }
+
+    return json_attrs;
+}
+
+/*
+ * Creates a HTMLTag json object and returns the pointer to it
+ */
+json_object *json_create_tag(HTMLTag *tag) {
+    json_object *json_tag = json_object_new_object();
+    json_object_object_add(json_tag, "name", json_object_new_string(tag->name));
+
+    if (tag->content) 
+        json_object_object_add(json_tag, "content", json_object_new_string(tag->content));
+
+    json_object_object_add(json_tag, "children_length", json_object_new_int(tag->children_length));
+
+    if (tag->attribute_length > 0)
+        json_object_object_add(json_tag, "attributes", json_create_attributes_array(tag->attributes, tag->attribute_length));
+
+    json_object_object_add(json_tag, "attribute_length", json_object_new_int(tag->attribute_length));
+
+    return json_tag;
+}
+
+/*
+ * Recursively traverses root HTMLTag and its children creating json arrays containing respective nested HTMLTags
+ */
+void json_traverse_children_and_create_tags(HTMLTag *root, json_object *json_root, json_object *root_children) {
+    bool add_children_array = root->children_length > 0;
+
+    for (int i = 0; i < root->children_length; i++) {
+        HTMLTag *child = *(root->children + i);
+        json_object *json_child = json_create_tag(child);
+        json_object *child_children = json_object_new_array();
+
+        json_object_array_add(root_children, json_child);
+        if (child->children_length > 0) {
+            json_traverse_children_and_create_tags(child, json_child, child_children);
+        }
+        else {
+            json_object_put(child_children);
+        }
+    }
+
+    if (add_children_array)
+        json_object_object_add(json_root, "children", root_children);
+}
+
+/*
+ * Creates a json object of a HTMLTag including all its descendants
+ */
+json_object *json_create_subtree(HTMLTag *root) {
+    json_object *json_root_tag = json_create_tag(root);
+    json_object *json_root_tag_children = json_object_new_array();
+
+    json_traverse_children_and_create_tags(root, json_root_tag, json_root_tag_children);
+
+    // Children array isn't attached to a tag without children
+    if (root->children_length == 0)
+        json_object_put(json_root_tag_children);
+
+    return json_root_tag;
+}
+
+/*
+ * Creates the top-level json array holding the root HTMLTag and all its descendants
+ * An empty document (root is NULL) results in an empty array
+ */
+json_object *json_create_document(HTMLTag *root) {
+    // Array of tags
+    json_object *tags = json_object_new_array();
+
+    if (root != NULL)
+        json_object_array_add(tags, json_create_subtree(root));
+
+    return tags;
+}
+
+/*
+ * Serializer of a placeholder: writes the subtree a worker rendered at level 0,
+ * indenting every line after the first by the placeholder's level
+ */
+int json_serialize_rendered(json_object *jso, struct printbuf *pb, int level, int flags) {
+    static const char spaces[] = "                                                                ";
+    const char *rendered = (const char*) json_object_get_userdata(jso);
+    const char *newline;
+
+    while ((newline = strchr(rendered, '\n')) != NULL) {
+        printbuf_memappend(pb, rendered, newline - rendered + 1);
+
+        // Same indentation as json-c: two spaces or a tab per level
+        if (flags & JSON_C_TO_STRING_PRETTY_TAB) {
+            for (int i = 0; i < level; i++)
+                printbuf_memappend(pb, "\t", 1);
+        }
+        else {
+            for (int indent = level * 2; indent > 0; indent -= (int) sizeof(spaces) - 1)
+                printbuf_memappend(pb, spaces, indent < (int) sizeof(spaces) - 1 ? indent : (int) sizeof(spaces) - 1);
+        }
+
+        rendered = newline + 1;
+    }
+
+    printbuf_memappend(pb, rendered, strlen(rendered));
+    return 0;
+}
+
+/*
+ * Creates a json object of a HTMLTag like json_create_subtree(), but every descendant subtree of at most
+ * max_task_nodes nodes becomes a placeholder and a task for the serialization workers
+ * Consecutive small siblings share a task as long as they have at most max_task_nodes nodes together
+ */
+json_object *json_partition_subtree(HTMLTag *tag, int max_task_nodes, SerializeJob *job) {
+    json_object *json_tag = json_create_tag(tag);
+
+    if (tag->children_length == 0)
+        return json_tag;
+
+    json_object *json_children = json_object_new_array();
+    SerializeTask *task = NULL; // task of the preceding siblings, while more of them fit in it
+    int task_nodes = 0;
+
+    for (int i = 0; i < tag->children_length; i++) {
+        HTMLTag *child = *(tag->children + i);
+
+        if (child->subtree_size > max_task_nodes) {
+            json_object_array_add(json_children, json_partition_subtree(child, max_task_nodes, job));
+            task = NULL;
+            continue;
+        }
+
+        if (task != NULL && task_nodes + child->subtree_size <= max_task_nodes) {
+            task->tags_length++;
+            task_nodes += child->subtree_size;
+            continue;
+        }
+
+        if (job->tasks_length == job->tasks_size) {
+            job->tasks_size = job->tasks_size ? job->tasks_size * 2 : 64;
+            job->tasks = (SerializeTask*) realloc(job->tasks, job->tasks_size * sizeof(SerializeTask));
+
+            if (job->tasks == NULL) {
+                perror("Failed to allocate memory for serialization tasks");
+                exit(1);
+            }
+        }
+
+        task = &job->tasks[job->tasks_length++];
+        task->tags = tag->children + i;
+        task->tags_length = 1;
+        task->placeholder = json_object_new_object();
+        task->rendered = NULL;
+        task_nodes = child->subtree_size;
+
+        json_object_array_add(json_children, task->placeholder);
+    }
+
+    json_object_object_add(json_tag, "children", json_children);
+    return json_tag;
+}
+
+/*
+ * Serialization worker: builds and renders subtrees until no tasks are left
+ * The siblings of a task are joined the way json-c separates array elements,
+ * json_serialize_rendered() adds the indentation after each newline
+ */
+void *serialize_worker(void *arg) {
+    SerializeJob *job = (SerializeJob*) arg;
+    const char *separator = job->flags & JSON_C_TO_STRING_PRETTY ? ",\n" : job->flags & JSON_C_TO_STRING_SPACED ? ", " : ",";
+    int i;
+
+    while ((i = atomic_fetch_add(&job->next_task, 1)) < job->tasks_length) {
+        SerializeTask *task = &job->tasks[i];
+        struct printbuf *pb = printbuf_new();
+
+        if (pb == NULL) {
+            perror("Failed to allocate memory for a serialized subtree");
+            exit(1);
+        }
+
+        for (int j = 0; j < task->tags_length; j++) {
+            json_object *json_subtree = json_create_subtree(task->tags[j]);
+
+            if (j > 0)
+                printbuf_memappend(pb, separator, strlen(separator));
+
+            const char *rendered = json_object_to_json_string_ext(json_subtree, job->flags);
+            printbuf_memappend(pb, rendered, strlen(rendered));
+            json_object_put(json_subtree);
+        }
+
+        task->rendered = strdup(pb->buf);
+        printbuf_free(pb);
+
+        if (task->rendered == NULL) {
+            perror("Failed to copy a serialized subtree");
+            exit(1);
+        }
+    }
+
+    return NULL;
+}
+
+/*
+ * Creates the same document as json_create_document(), with the subtrees already serialized in parallel
+ * Rendering the result with the same flags gives byte-identical output
+ * E.g. json_object_to_file_ext(fname, json_create_document_parallel(root, 4, JSON_OUTPUT_FLAGS), JSON_OUTPUT_FLAGS)
+ */
+json_object *json_create_document_parallel(HTMLTag *root, int workers_length, int flags) {
+    if (root == NULL || workers_length <= 1 || root->subtree_size < SERIALIZE_MIN_NODES)
+        return json_create_document(root);
+
+    SerializeJob job = { .flags = flags };
+    int max_task_nodes = root->subtree_size / (workers_length * SERIALIZE_TASKS_PER_WORKER);
+
+    json_object *tags = json_object_new_array();
+    json_object_array_add(tags, json_partition_subtree(root, max_task_nodes > 1 ? max_task_nodes : 1, &job));
+
+    // The calling thread works through the tasks too
+    pthread_t *threads = (pthread_t*) calloc(workers_length - 1, sizeof(pthread_t));
+    int threads_length = 0;
+
+    if (threads == NULL) {
+        perror("Failed to allocate memory for serialization workers");
+        exit(1);
+    }
+
+    // Tasks left over by threads that couldn't be started are done by the others
+    for (int i = 0; i < workers_length - 1; i++) {
+        if (pthread_create(&threads[threads_length], NULL, serialize_worker, &job) != 0) {
+            perror("Failed to start serialization worker");
+            break;
+        }
+
+        threads_length++;
+    }
+
+    serialize_worker(&job);
+
+    for (int i = 0; i < threads_length; i++) {
+        pthread_join(threads[i], NULL);
+    }
+
+    // Placeholders own the rendered strings from now on
+    for (int i = 0; i < job.tasks_length; i++) {
+        SerializeTask *task = &job.tasks[i];
+        json_object_set_serializer(task->placeholder, json_serialize_rendered, task->rendered, json_object_free_userdata);
+    }
+
+    free(threads);
+    free(job.tasks);
+
+    return tags;
+}
+
+/*
+ * Parses a file once and times serializing it with 1, 2, 4, ... max_workers threads,
+ * checking that every run gives the same output as the sequential one
+ */
+int benchmark_serialization(const char *html_filename, int max_workers) {
+    Decompressor *decompressor;
+    FILE *stream = open_file(html_filename, &decompressor);
+    if (!stream) return 1;
+
+    InternTable table;
+    intern_table_init(&table);
+
+    const char *error;
+    HTMLTag *root = parse_tags(stream, &table, &error);
+    bool read_ok = close_file(stream, decompressor);
+
+    if (error || !read_ok) {
+        if (error)
+            printf("Failed to parse %s: %s\n", html_filename, error);
+        else
+            printf("Failed to read %s\n", html_filename);
+
+        if (root) free_tag(root);
+        intern_table_free(&table);
+        return 1;
+    }
+
+    char *sequential = NULL;
+    double sequential_seconds = 0;
+    bool identical = true;
+
+    printf("\nSerialization of %s (%d nodes):\n", html_filename, root ? root->subtree_size : 0);
+
+    // Powers of two, then max_workers itself
+    for (int workers_length = 1; workers_length <= max_workers;
+         workers_length = workers_length < max_workers && workers_length * 2 > max_workers ? max_workers : workers_length * 2) {
+        json_object *tags = NULL;
+        const char *rendered = NULL;
+        size_t length = 0;
+        double elapsed = 0;
+
+        // Best of a few runs, the first one also pays for warming up the allocator
+        for (int run = 0; run < SERIALIZE_BENCHMARK_RUNS; run++) {
+            if (tags)
+                json_object_put(tags);
+
+            double start = now();
+
+            tags = json_create_document_parallel(root, workers_length, JSON_OUTPUT_FLAGS);
+            rendered = json_object_to_json_string_length(tags, JSON_OUTPUT_FLAGS, &length);
+
+            double run_seconds = now() - start;
+            if (run == 0 || run_seconds < elapsed)
+                elapsed = run_seconds;
+        }
+
+        bool same = true;
+
+        if (sequential == NULL) {
+            sequential = strdup(rendered);
+            sequential_seconds = elapsed;
+        }
+        else {
+            same = strequals(sequential, rendered);
+            identical = identical && same;
+        }
+
+        printf("  %2d threads: %.3f s, %.1f MB/s, speedup %.2fx%s\n",
+               workers_length, elapsed, length / elapsed / 1e6, sequential_seconds / elapsed,
+               same ? "" : ", OUTPUT DIFFERS");
+
+        json_object_put(tags);
+    }
+
+    free(sequential);
+    if (root)
+        free_tag(root);
+    intern_table_free(&table);
+
+    return identical ? 0 : 1;
+}
+
+/*
+ * Reads exactly length bytes from a file descriptor
+ * Returns false on EOF or error
+ */
+bool read_exact(int fd, void *buf, size_t length) {
+    char *b = (char*) buf;
+
+    while (length > 0) {
+        ssize_t n = read(fd, b, length);
+        if (n <= 0)
+            return false;
+
+        b += n;
+        length -= n;
+    }
+
+    return true;
+}
+
+/*
+ * Writes all buffers described by iov to a file descriptor, resuming after partial writes
+ * Returns false on error
+ */
+bool writev_exact(int fd, struct iovec *iov, int iov_length) {
+    while (iov_length > 0) {
+        ssize_t n = writev(fd, iov, iov_length);
+        if (n < 0)
+            return false;
+
+        // Skip fully written buffers and shift into the partially written one
+        while (iov_length > 0 && (size_t) n >= iov->iov_len) {
+            n -= iov->iov_len;
+            iov++;
+            iov_length--;
+        }
+
+        if (iov_length > 0) {
+            iov->iov_base = (char*) iov->iov_base + n;
+            iov->iov_len -= n;
+        }
+    }
+
+    return true;
+}
+
+/*
+ * Adds a connection with a readable request to the end of the queue, growing the ring if it's full
+ */
+void server_queue_push(ServerQueue *queue, int fd) {
+    pthread_mutex_lock(&queue->lock);
+
+    if (queue->length == queue->size) {
+        int new_size = queue->size ? queue->size * 2 : 64;
+        int *new_fds = (int*) malloc(new_size * sizeof(int));
+
+        if (new_fds == NULL) {
+            perror("Failed to allocate memory for the request queue");
+            exit(1);
+        }
+
+        // Unwrap the ring into the new buffer
+        for (int i = 0; i < queue->length; i++) {
+            new_fds[i] = queue->fds[(queue->head + i) % queue->size];
+        }
+
+        free(queue->fds);
+        queue->fds = new_fds;
+        queue->head = 0;
+        queue->size = new_size;
+    }
+
+    queue->fds[(queue->head + queue->length) % queue->size] = fd;
+    queue->length++;
+
+    pthread_cond_signal(&queue->not_empty);
+    pthread_mutex_unlock(&queue->lock);
+}
+
+/*
+ * Takes the next connection off the queue, waiting until there is one
+ */
+int server_queue_pop(ServerQueue *queue) {
+    pthread_mutex_lock(&queue->lock);
+
+    while (queue->length == 0)
+        pthread_cond_wait(&queue->not_empty, &queue->lock);
+
+    int fd = queue->fds[queue->head];
+    queue->head = (queue->head + 1) % queue->size;
+    queue->length--;
+
+    pthread_mutex_unlock(&queue->lock);
+    return fd;
+}
+
+/*
+ * Writes a json object as a length-prefixed response
+ * Returns false on error
+ */
+bool send_response(int fd, json_object *response) {
+    size_t json_length = 0;
+    const char *json = json_object_to_json_string_length(response, JSON_OUTPUT_FLAGS, &json_length);
+
+    uint32_t header = htonl((uint32_t) json_length);
+    struct iovec iov[2] = {
+        { .iov_base = &header, .iov_len = sizeof(header) },
+        { .iov_base = (void*) json, .iov_len = json_length },
+    };
+
+    // Header and body go out in one syscall in the common case
+    return writev_exact(fd, iov, 2);
+}
+
+/*
+ * Reads a length-prefixed HTML payload of a given length, parses it and writes back the length-prefixed JSON
+ * Malformed HTML is answered with {"error": message} and the connection stays open
+ * Returns false if the connection should be closed
+ */
+bool handle_request(ServerWorker *worker, int fd, size_t length) {
+    HTMLTag *root = NULL;
+    const char *error = NULL;
+    InternTable table; // per request, so a long-running server doesn't keep every string it has seen
+
+    // Grow the worker's buffer only when a bigger payload arrives
+    if (length + 1 > worker->bufsize) {
+        char *new_buf = realloc(worker->buf, length + 1);
+        if (new_buf == NULL) {
+            perror("Failed to reallocate memory for the request buffer");
+            return false;
+        }
+
+        worker->buf = new_buf;
+        worker->bufsize = length + 1;
+    }
+
+    if (!read_exact(fd, worker->buf, length))
+        return false;
+
+    worker->buf[length] = '\0';
+
+    if (length > 0) {
+        // Parse straight from the request buffer, no temporary file involved
+        FILE *stream = fmemopen(worker->buf, length, "r");
+        if (stream == NULL) {
+            perror("Failed to open request buffer as a stream");
+            return false;
+        }
+
+        intern_table_init(&table);
+        root = parse_tags(stream, &table, &error);
+        fclose(stream);
+    }
+
+    json_object *response;
+
+    if (error) {
+        response = json_object_new_object();
+        json_object_object_add(response, "error", json_object_new_string(error));
+    }
+    else {
+        response = json_create_document(root);
+    }
+
+    bool ok = send_response(fd, response);
+
+    json_object_put(response);
+    if (root)
+        free_tag(root);
+    if (length > 0)
+        intern_table_free(&table);
+
+    return ok;
+}
+
+/*
+ * Reads one request from a connection and answers it
+ * Returns false if the connection should be closed (client closed it, timed out or sent an oversized request)
+ */
+bool serve_request(ServerWorker *worker, int fd) {
+    uint32_t header;
+
+    if (!read_exact(fd, &header, sizeof(header)))
+        return false;
+
+    size_t length = ntohl(header);
+
+    if (length > SERVER_MAX_PAYLOAD) {
+        printf("Request of %zu bytes exceeds the payload limit\n", length);
+        return false;
+    }
+
+    return handle_request(worker, fd, length);
+}
+
+/*
+ * Worker thread: serves one request at a time from whichever connection is ready
+ * A connection is in the queue at most once (EPOLLONESHOT), so pipelined requests
+ * are still answered in order, and it's re-armed only after its request is answered
+ */
+void *server_worker(void *arg) {
+    ServerWorker *worker = (ServerWorker*) arg;
+
+    while (true) {
+        int fd = server_queue_pop(worker->queue);
+
+        if (!serve_request(worker, fd)) {
+            close(fd);
+            continue;
+        }
+
+        // Level-triggered, so requests that are already buffered make it ready again right away
+        struct epoll_event event = { .events = EPOLLIN | EPOLLONESHOT, .data.fd = fd };
+        if (epoll_ctl(worker->epoll_fd, EPOLL_CTL_MOD, fd, &event) < 0) {
+            perror("Failed to re-arm connection");
+            close(fd);
+        }
+    }
+
+    return NULL;
+}
+
+/*
+ * Listens on a Unix domain socket and serves parse requests with a pool of worker threads
+ * Each request is a 4-byte big-endian length followed by the HTML, each response the same framing around the JSON
+ * The calling thread accepts connections and queues the ones with a readable request, so any number
+ * of connections share the workers
+ */
+int serve(const char *socket_path, int workers_length) {
+    struct sockaddr_un addr = { .sun_family = AF_UNIX };
+
+    if (strlength(socket_path) >= sizeof(addr.sun_path)) {
+        printf("Socket path is too long: %s\n", socket_path);
+        return 1;
+    }
+
+    strcpy(addr.sun_path, socket_path);
+
+    // A client that disconnects mid-response must not kill the server
+    signal(SIGPIPE, SIG_IGN);
+
+    int listen_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listen_fd < 0) {
+        perror("Failed to create socket");
+        return 1;
+    }
+
+    unlink(socket_path);
+    if (bind(listen_fd, (struct sockaddr*) &addr, sizeof(addr)) < 0 || listen(listen_fd, SOMAXCONN) < 0) {
+        perror("Failed to listen on socket");
+        close(listen_fd);
+        return 1;
+    }
+
+    int epoll_fd = epoll_create1(0);
+    struct epoll_event listen_event = { .events = EPOLLIN, .data.fd = listen_fd };
+
+    if (epoll_fd < 0 || epoll_ctl(epoll_fd, EPOLL_CTL_ADD, listen_fd, &listen_event) < 0) {
+        perror("Failed to set up epoll");
+        close(listen_fd);
+        return 1;
+    }
+
+    ServerQueue queue = { .lock = PTHREAD_MUTEX_INITIALIZER, .not_empty = PTHREAD_COND_INITIALIZER };
+    ServerWorker *workers = (ServerWorker*) calloc(workers_length, sizeof(ServerWorker));
+    pthread_t *threads = (pthread_t*) calloc(workers_length, sizeof(pthread_t));
+
+    if (workers == NULL || threads == NULL) {
+        perror("Failed to allocate memory for server workers");
+        exit(1);
+    }
+
+    printf("Listening on %s with %d workers\n", socket_path, workers_length);
+
+    for (int i = 0; i < workers_length; i++) {
+        workers[i].epoll_fd = epoll_fd;
+        workers[i].queue = &queue;
+
+        if (pthread_create(&threads[i], NULL, server_worker, &workers[i]) != 0) {
+            perror("Failed to start server worker");
+            exit(1);
+        }
+    }
+
+    struct epoll_event events[SERVER_MAX_EVENTS];
+
+    while (true) {
+        int events_length = epoll_wait(epoll_fd, events, SERVER_MAX_EVENTS, -1);
+
+        if (events_length < 0) {
+            perror("Failed to wait for connections");
+            continue;
+        }
+
+        for (int i = 0; i < events_length; i++) {
+            int fd = events[i].data.fd;
+
+            if (fd != listen_fd) {
+                // Readable (or closed) connection, disarmed until a worker has answered its request
+                server_queue_push(&queue, fd);
+                continue;
+            }
+
+            int conn_fd = accept(listen_fd, NULL, NULL);
+            if (conn_fd < 0) {
+                perror("Failed to accept connection");
+                continue;
+            }
+
+            // A client that stops halfway through a request doesn't hold a worker forever
+            struct timeval timeout = { .tv_sec = SERVER_READ_TIMEOUT };
+            setsockopt(conn_fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+            struct epoll_event conn_event = { .events = EPOLLIN | EPOLLONESHOT, .data.fd = conn_fd };
+            if (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, conn_fd, &conn_event) < 0) {
+                perror("Failed to watch connection");
+                close(conn_fd);
+            }
+        }
+    }
+
+    return 0;
+}
+
+/*
+ * Looks up a header in a block of "Name: value\r\n" lines (case-insensitively)
+ * Returns a pointer to the value and stores its length, or NULL if the header is missing
+ */
+const char *find_header(const char *headers, const char *end, const char *name, size_t *value_length) {
+    size_t name_length = strlength(name);
+    const char *line = headers;
+
+    while (line < end) {
+        const char *line_end = memchr(line, '\n', end - line);
+        if (line_end == NULL)
+            line_end = end;
+
+        if ((size_t) (line_end - line) > name_length && line[name_length] == ':' && strncasecmp(line, name, name_length) == 0) {
+            const char *value = line + name_length + 1;
+            const char *value_end = line_end;
+
+            while (value < value_end && (*value == ' ' || *value == '\t'))
+                value++;
+            while (value_end > value && (value_end[-1] == '\r' || value_end[-1] == ' '))
+                value_end--;
+
+            *value_length = value_end - value;
+            return value;
+        }
+
+        line = line_end + 1;
+    }
+
+    return NULL;
+}
+
+/*
+ * Parses a decimal length that isn't NUL-terminated
+ */
+size_t parse_length(const char *str, size_t length) {
+    size_t result = 0;
+
+    for (size_t i = 0; i < length && isdigit((unsigned char) str[i]); i++) {
+        result = result * 10 + (str[i] - '0');
+    }
+
+    return result;
+}
+
+/*
+ * Decodes a body sent with Transfer-Encoding: chunked into out, which must hold length bytes
+ * Chunk extensions and trailers are ignored
+ * Returns the decoded length, or -1 if the chunks are malformed or the last chunk is missing
+ * E.g. "5\r\nHello\r\n0\r\n\r\n" => "Hello"
+ */
+ssize_t dechunk_body(const char *body, size_t length, char *out) {
+    const char *pos = body;
+    const char *end = body + length;
+    size_t offset = 0;
+
+    while (pos < end) {
+        size_t chunk_length = 0;
+        int digits = 0;
+
+        while (pos < end && isxdigit((unsigned char) *pos)) {
+            int digit = isdigit((unsigned char) *pos) ? *pos - '0' : (tolower((unsigned char) *pos) - 'a' + 10);
+            chunk_length = chunk_length * 16 + digit;
+            digits++;
+            pos++;
+
+            if (chunk_length > length)
+                return -1;
+        }
+
+        // The size line may carry extensions, e.g. "1a;name=value"
+        const char *line_end = memchr(pos, '\n', end - pos);
+        if (digits == 0 || line_end == NULL)
+            return -1;
+
+        pos = line_end + 1;
+
+        if (chunk_length == 0)
+            return offset;
+
+        if (chunk_length > (size_t) (end - pos))
+            return -1;
+
+        memcpy(out + offset, pos, chunk_length);
+        offset += chunk_length;
+        pos += chunk_length;
+
+        // Data is followed by CRLF
+        if (pos < end && *pos == '\r') pos++;
+        if (pos < end && *pos == '\n') pos++;
+    }
+
+    return -1;
+}
+
+/*
+ * Indexes the records of a WARC file in a single pass over the mapped data
+ * Only HTML responses are kept, their bodies aren't copied
+ * Returns the number of records, or -1 if the file is malformed
+ */
+int index_warc_records(const char *data, size_t size, WarcRecord **records_ptr) {
+    const char *end = data + size;
+    const char *pos = data;
+    WarcRecord *records = NULL;
+    int records_length = 0;
+    int records_size = 0;
+
+    while (pos < end) {
+        // Records are separated by an empty line
+        while (pos < end && (*pos == '\r' || *pos == '\n'))
+            pos++;
+
+        if (pos == end)
+            break;
+
+        if (end - pos < 5 || memcmp(pos, "WARC/", 5) != 0) {
+            printf("Expected WARC record at offset %zu\n", (size_t) (pos - data));
+            free(records);
+            return -1;
+        }
+
+        const char *headers_end = memmem(pos, end - pos, "\r\n\r\n", 4);
+        if (headers_end == NULL) {
+            printf("Unterminated WARC headers at offset %zu\n", (size_t) (pos - data));
+            free(records);
+            return -1;
         }
-        else if (strequals(expected_token, "tag_name")) {
-            if (isalnum(chr) || chr == '/') {
-                tag_name[offset++] = chr;
-            }
-            else if (chr == '>' && strlength(tag_name) > 0) {
-                // If the tag is not of closing type, it can't have content
-                if (tag_name[0] != '/') {
-                    free(tag_content);
-                    tag_content = NULL;
-                } 
 
-                tag = create_tag_from_string(tag_name, tag_content);
-                line++;
-                printf("Closing arrow\n");
-                break;
-            }
-            else if (chr == ' ' && strlength(tag_name) > 0) {
-                // TODO: In here we know for sure it's an opening tag.
-                // If tag_content isn't empty, means that it's arbitrary text
-                // that belongs to this tag's parent. Shadow text tag
-                tag = create_tag_from_string(tag_name, NULL);
-                expected_token = "attr_name";
-                offset = 0;
+        size_t length;
+        const char *value = find_header(pos, headers_end + 2, "Content-Length", &length);
+        size_t block_length = value ? parse_length(value, length) : 0;
+        const char *block = headers_end + 4;
 
-                printf("Expected: %s\n", expected_token);
-            }
-            // Comment tag
-            else if (chr == '!') {
-                // !--
-                printf("Comment opened\n");
-                if (strlength(line) >= 3) {
-                    if (*(line + 1) == '-' && *(line + 2) == '-') {
-                        COMMENT_OPENED = true;
-                        line += 3;
-                        continue;
-                    }
-                    else
-                        error_exit = true;
-                }
-                else
-                    error_exit = true;
+        if (value == NULL || block_length > (size_t) (end - block)) {
+            printf("Invalid or truncated WARC record at offset %zu\n", (size_t) (pos - data));
+            free(records);
+            return -1;
+        }
 
-                if (error_exit) {
-                    printf("Invalid comment syntax.\n");
-                    break;
+        WarcRecord record = { 0 };
+        const char *type = find_header(pos, headers_end + 2, "WARC-Type", &length);
+
+        if (type != NULL && length == 8 && strncasecmp(type, "response", 8) == 0) {
+            // The block is an HTTP response: status line and headers, then the body
+            const char *http_headers_end = memmem(block, block_length, "\r\n\r\n", 4);
+            const char *content_type = NULL;
+            const char *content_encoding = NULL;
+            const char *transfer_encoding = NULL;
+
+            if (http_headers_end != NULL) {
+                content_type = find_header(block, http_headers_end + 2, "Content-Type", &length);
+                bool is_html = content_type == NULL || memmem(content_type, length, "html", 4) != NULL;
+
+                // Compressed bodies are skipped
+                content_encoding = find_header(block, http_headers_end + 2, "Content-Encoding", &length);
+                bool is_identity = content_encoding == NULL || (length == 8 && strncasecmp(content_encoding, "identity", 8) == 0);
+
+                // Chunked bodies are decoded when the record is parsed, other transfer codings are skipped
+                transfer_encoding = find_header(block, http_headers_end + 2, "Transfer-Encoding", &length);
+                bool is_chunked = transfer_encoding != NULL && length == 7 && strncasecmp(transfer_encoding, "chunked", 7) == 0;
+                is_identity = is_identity && (transfer_encoding == NULL || is_chunked ||
+                                              (length == 8 && strncasecmp(transfer_encoding, "identity", 8) == 0));
+
+                if (is_html && is_identity) {
+                    record.body = http_headers_end + 4;
+                    record.body_length = block + block_length - record.body;
+                    record.chunked = is_chunked;
+                    record.id = find_header(pos, headers_end + 2, "WARC-Record-ID", &record.id_length);
+                    record.uri = find_header(pos, headers_end + 2, "WARC-Target-URI", &record.uri_length);
                 }
             }
-            else {
-                error_exit = true;
-                printf("Expected %s: Bad tag\n", expected_token);
-                break;
-            }
         }
-        else if (strequals(expected_token, "attr_name")) {
-            if (isalpha(chr)) {
-                attr_name[offset++] = chr;
-            }
-            // Attribute value separator
-            else if (chr == '=' && strlength(attr_name) > 0) {
-                expected_token = "attr_value_open";
-                offset = 0;
 
-                printf("Expected: %s\n", expected_token);
-            }
-            else {
-                error_exit = true;
-                printf("Expected %s: Bad tag\n", expected_token);
-                break;
+        if (record.body != NULL) {
+            if (records_length == records_size) {
+                records_size = records_size ? records_size * 2 : 64;
+                WarcRecord *new_records = (WarcRecord*) realloc(records, sizeof(WarcRecord) * records_size);
+
+                if (new_records == NULL) {
+                    perror("Failed to reallocate memory for WARC records");
+                    exit(1);
+                }
+
+                records = new_records;
             }
+
+            records[records_length++] = record;
         }
-        else if (strequals(expected_token, "attr_value_open")) {
-            if (chr == '"') {
-                expected_token = "attr_value";
-                printf("Expected: %s\n", expected_token);
-            }
-            else {
-                error_exit = true;
-                printf("Expected %s: Bad tag. No opening quotes in attribute value\n", expected_token);
-                break;
-            }
+
+        pos = block + block_length;
+    }
+
+    *records_ptr = records;
+    return records_length;
+}
+
+/*
+ * Parses the body of a WARC record and stores its JSON line in record->output
+ * A record that fails to parse gets {"record_id", "uri", "error"} instead of "tags", the others aren't affected
+ */
+void parse_warc_record(WarcRecord *record, InternTable *table) {
+    HTMLTag *root = NULL;
+    const char *error = NULL;
+    const char *body = record->body;
+    ssize_t body_length = record->body_length;
+    char *dechunked = NULL;
+
+    if (record->chunked) {
+        dechunked = (char*) malloc(record->body_length + 1);
+        if (dechunked == NULL) {
+            perror("Failed to allocate memory for a chunked WARC record body");
+            exit(1);
         }
-        else if (strequals(expected_token, "attr_value")) {
-            if (isalnum(chr) || char_in(VALID_ATTR_SPECIAL_CHARS, chr)) {
-                attr_value[offset++] = chr;
-            }
-            else if (chr == '"') {
-                expected_token = "attr_separator_or_close_tag";
-                offset = 0;
 
-                // Add attr to HTMLTag
-                attr = create_attribute(attr_name, attr_value);
-                add_attribute(tag, attr);
+        body = dechunked;
+        body_length = dechunk_body(record->body, record->body_length, dechunked);
+
+        if (body_length < 0)
+            error = "Malformed chunked body";
+    }
+
+    if (body_length > 0) {
+        // The stream reads straight from the mapped file, the body isn't copied unless it was chunked
+        FILE *stream = fmemopen((void*) body, body_length, "r");
+        if (stream == NULL) {
+            perror("Failed to open WARC record body as a stream");
+            exit(1);
+        }
+
+        root = parse_tags(stream, table, &error);
+        fclose(stream);
+    }
+
+    json_object *json_record = json_object_new_object();
+    json_object_object_add(json_record, "record_id", record->id ? json_object_new_string_len(record->id, record->id_length) : NULL);
+    json_object_object_add(json_record, "uri", record->uri ? json_object_new_string_len(record->uri, record->uri_length) : NULL);
+
+    if (error) {
+        printf("Failed to parse WARC record %.*s: %s\n", (int) record->id_length, record->id ? record->id : "", error);
+        json_object_object_add(json_record, "error", json_object_new_string(error));
+        record->failed = true;
+    }
+    else {
+        json_object_object_add(json_record, "tags", json_create_document(root));
+    }
+
+    // One record per line
+    size_t json_length = 0;
+    const char *json = json_object_to_json_string_length(json_record, JSON_C_TO_STRING_PLAIN, &json_length);
+
+    record->output = (char*) malloc(json_length + 1);
+    if (record->output == NULL) {
+        perror("Failed to allocate memory for WARC record output");
+        exit(1);
+    }
+
+    memcpy(record->output, json, json_length);
+    record->output[json_length] = '\n';
+    record->output_length = json_length + 1;
+
+    json_object_put(json_record);
+    if (root)
+        free_tag(root);
+    free(dechunked);
+}
+
+/*
+ * Worker thread: takes the next unparsed record until there are none left
+ */
+void *warc_worker(void *arg) {
+    WarcJob *job = (WarcJob*) arg;
+    InternTable table;
+    intern_table_init(&table);
+
+    while (true) {
+        pthread_mutex_lock(&job->lock);
+        int i = job->next_record++;
+        pthread_mutex_unlock(&job->lock);
+
+        if (i >= job->records_length)
+            break;
+
+        parse_warc_record(&job->records[i], &table);
+
+        pthread_mutex_lock(&job->lock);
+        job->records[i].done = true;
+        pthread_cond_broadcast(&job->record_done);
+        pthread_mutex_unlock(&job->lock);
+    }
+
+    // Records are serialized as soon as they're parsed, nothing points into the table anymore
+    pthread_mutex_lock(&job->lock);
+    intern_stats_add(&job->interned, &table);
+    pthread_mutex_unlock(&job->lock);
+    intern_table_free(&table);
+
+    return NULL;
+}
+
+/*
+ * Converts every HTML response of a WARC file into a line of JSON, in input order
+ * Records are parsed in parallel by a pool of workers
+ */
+int convert_warc(const char *warc_filename, const char *json_filename, int workers_length) {
+    int fd = open(warc_filename, O_RDONLY);
+    struct stat st;
+
+    if (fd < 0 || fstat(fd, &st) < 0) {
+        perror("File opening failed");
+        if (fd >= 0) close(fd);
+        return 1;
+    }
+
+    if (st.st_size == 0) {
+        printf("%s is empty\n", warc_filename);
+        close(fd);
+        return 1;
+    }
+
+    const char *data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+
+    if (data == MAP_FAILED) {
+        perror("Failed to map WARC file");
+        return 1;
+    }
+
+    madvise((void*) data, st.st_size, MADV_SEQUENTIAL);
+
+    WarcJob job = { 0 };
+    job.records_length = index_warc_records(data, st.st_size, &job.records);
+
+    if (job.records_length < 0) {
+        munmap((void*) data, st.st_size);
+        return 1;
+    }
+
+    printf("Indexed %d HTML records in %s\n", job.records_length, warc_filename);
+
+    FILE *output = fopen(json_filename, "w");
+    if (!output) {
+        perror("Failed to open output file");
+        free(job.records);
+        munmap((void*) data, st.st_size);
+        return 1;
+    }
+
+    pthread_mutex_init(&job.lock, NULL);
+    pthread_cond_init(&job.record_done, NULL);
+
+    pthread_t *threads = (pthread_t*) calloc(workers_length, sizeof(pthread_t));
+    if (threads == NULL) {
+        perror("Failed to allocate memory for WARC workers");
+        exit(1);
+    }
+
+    for (int i = 0; i < workers_length; i++) {
+        if (pthread_create(&threads[i], NULL, warc_worker, &job) != 0) {
+            perror("Failed to start WARC worker");
+            exit(1);
+        }
+    }
+
+    int failed_length = 0;
+
+    // Write records in input order as soon as each one is done
+    for (int i = 0; i < job.records_length; i++) {
+        pthread_mutex_lock(&job.lock);
+        while (!job.records[i].done)
+            pthread_cond_wait(&job.record_done, &job.lock);
+        pthread_mutex_unlock(&job.lock);
+
+        fwrite(job.records[i].output, 1, job.records[i].output_length, output);
+        failed_length += job.records[i].failed;
+        free(job.records[i].output);
+        job.records[i].output = NULL;
+    }
+
+    for (int i = 0; i < workers_length; i++) {
+        pthread_join(threads[i], NULL);
+    }
+
+    printf("Saved %d JSON records to %s (%d failed to parse)\n", job.records_length, json_filename, failed_length);
+    print_intern_report(&job.interned, "");
+
+    fclose(output);
+    free(threads);
+    free(job.records);
+    pthread_mutex_destroy(&job.lock);
+    pthread_cond_destroy(&job.record_done);
+    munmap((void*) data, st.st_size);
+
+    return 0;
+}
+
+/*
+ * Appends a file to the end of a queue
+ */
+void batch_queue_push(BatchQueue *queue, BatchFile *file) {
+    file->next = NULL;
+
+    if (queue->tail)
+        queue->tail->next = file;
+    else
+        queue->head = file;
+
+    queue->tail = file;
+}
+
+/*
+ * Removes and returns the first file of a queue, or NULL if it's empty
+ */
+BatchFile *batch_queue_pop(BatchQueue *queue) {
+    BatchFile *file = queue->head;
+
+    if (file) {
+        queue->head = file->next;
+        if (queue->head == NULL)
+            queue->tail = NULL;
+    }
+
+    return file;
+}
+
+/*
+ * Returns a newly allocated output filename for an input file
+ * E.g. "page.html" => "page.json"
+ *      "page.html.gz" => "page.json"
+ *      "page" => "page.json"
+ */
+char *batch_output_filename(const char *input_filename) {
+    char *extensions[] = { ".gz", ".zst", ".html", ".htm" };
+    size_t length = strlength(input_filename);
+    char *result = (char*) calloc(length + 6, sizeof(char));
+
+    if (result == NULL) {
+        perror("Failed to allocate memory for the output filename");
+        exit(1);
+    }
+
+    memcpy(result, input_filename, length);
+
+    // Strip compression, then HTML extensions
+    for (int i = 0; i < (int) (sizeof(extensions) / sizeof(char*)); i++) {
+        size_t extension_length = strlength(extensions[i]);
+
+        if (length > extension_length && strequals(result + length - extension_length, extensions[i])) {
+            length -= extension_length;
+            result[length] = '\0';
+        }
+    }
+
+    strcpy(result + length, ".json");
+    return result;
+}
+
+/*
+ * Reads a whole file into file->data with blocking syscalls
+ */
+bool batch_read_file(BatchFile *file) {
+    int fd = open(file->input_filename, O_RDONLY);
+    struct stat st;
+
+    if (fd < 0 || fstat(fd, &st) < 0) {
+        perror(file->input_filename);
+        if (fd >= 0) close(fd);
+        return false;
+    }
+
+    file->size = st.st_size;
+    file->data = (char*) malloc(file->size + 1);
+
+    size_t offset = 0;
+    while (file->data && offset < file->size) {
+        ssize_t n = read(fd, file->data + offset, file->size - offset);
+        if (n <= 0)
+            break;
+
+        offset += n;
+    }
+
+    close(fd);
+
+    if (file->data == NULL || offset < file->size) {
+        perror(file->input_filename);
+        free(file->data);
+        file->data = NULL;
+        return false;
+    }
+
+    return true;
+}
+
+/*
+ * Writes file->output to the output file with blocking syscalls
+ */
+bool batch_write_file(BatchFile *file) {
+    int fd = open(file->output_filename, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+
+    if (fd < 0) {
+        perror(file->output_filename);
+        return false;
+    }
+
+    size_t offset = 0;
+    while (offset < file->output_length) {
+        ssize_t n = write(fd, file->output + offset, file->output_length - offset);
+        if (n < 0)
+            break;
+
+        offset += n;
+    }
+
+    close(fd);
+
+    if (offset < file->output_length) {
+        perror(file->output_filename);
+        return false;
+    }
+
+    return true;
+}
+
+/*
+ * Parses file->data and serializes it into file->output, then releases the input
+ * Returns false if the file is malformed, file->output isn't set then
+ */
+bool batch_parse_file(BatchFile *file, SubtreeStore *store, InternTable *table) {
+    HTMLTag *root = NULL;
+
+    if (file->size > 0) {
+        FILE *stream = fmemopen(file->data, file->size, "r");
+        Decompressor *decompressor = NULL;
+
+        // Compressed input is decompressed from memory just like open_file() does for files
+        char *format = detect_compression((unsigned char*) file->data, file->size);
+        if (stream && format)
+            stream = open_decompressed(stream, format, &decompressor);
+
+        if (stream == NULL) {
+            perror("Failed to open file contents as a stream");
+            exit(1);
+        }
+
+        const char *error;
+        root = parse_tags(stream, table, &error);
+        bool read_ok = close_file(stream, decompressor);
+
+        if (error || !read_ok) {
+            if (error)
+                printf("Failed to parse %s: %s\n", file->input_filename, error);
+            else
+                printf("Failed to read %s\n", file->input_filename);
+
+            if (root)
+                free_tag(root);
+
+            free(file->data);
+            file->data = NULL;
+            return false;
+        }
+    }
+
+    json_object *tags;
+
+    if (store && root) {
+        tags = json_object_new_array();
+        json_object_array_add(tags, json_create_deduplicated_subtree(root, store));
+    }
+    else {
+        tags = json_create_document(root);
+    }
+
+    const char *json = json_object_to_json_string_length(tags, JSON_OUTPUT_FLAGS, &file->output_length);
+
+    file->output = (char*) malloc(file->output_length);
+    if (file->output == NULL) {
+        perror("Failed to allocate memory for the JSON output");
+        exit(1);
+    }
+
+    memcpy(file->output, json, file->output_length);
+
+    json_object_put(tags);
+    if (root)
+        free_tag(root);
+
+    free(file->data);
+    file->data = NULL;
+
+    return true;
+}
+
+/*
+ * Hands a file that has been read over to the parsers (job->lock must be held)
+ */
+void batch_file_read(BatchJob *job, BatchFile *file, bool ok) {
+    job->reads_in_flight--;
+
+    if (ok) {
+        job->bytes_read += file->size;
+        batch_queue_push(&job->parse_queue, file);
+    }
+    else {
+        job->in_memory--;
+        job->finished++;
+        job->failed++;
+    }
+
+    pthread_cond_broadcast(&job->changed);
+}
+
+/*
+ * Marks a file as done and releases its output (job->lock must be held)
+ */
+void batch_file_written(BatchJob *job, BatchFile *file, bool ok) {
+    if (ok)
+        job->bytes_written += file->output_length;
+    else
+        job->failed++;
+
+    free(file->output);
+    file->output = NULL;
+
+    job->in_memory--;
+    job->finished++;
+    pthread_cond_broadcast(&job->changed);
+}
 
-                printf("Expected: %s\n", expected_token);
+/*
+ * Parser thread: parses files as soon as they have been read
+ */
+void *batch_parse_worker(void *arg) {
+    BatchJob *job = (BatchJob*) arg;
+    InternTable table;
+    intern_table_init(&table);
 
-                free(attr_name);
-                free(attr_value);
+    pthread_mutex_lock(&job->lock);
 
-                // Reset pointers to null so that we know we don't need to free them anymore
-                // We don't free attr because it's a pointer that's now attached to the tag
-                attr = NULL;
-                attr_name = NULL;
-                attr_value = NULL;
-            }
-            else {
-                error_exit = true;
-                printf("Expected %s: Bad tag.\n", expected_token);
-                break;
-            }
-        }
-        else if (strequals(expected_token, "attr_separator_or_close_tag")) {
-            if (chr == ' ') {
-                expected_token = "attr_name";
+    while (true) {
+        BatchFile *file = batch_queue_pop(&job->parse_queue);
 
-                // Reallocate freed pointers
-                attr_name = (char*) calloc(128, sizeof(char));
-                attr_value = (char*) calloc(128, sizeof(char));
+        if (file) {
+            pthread_mutex_unlock(&job->lock);
 
-                printf("Expected: %s\n", expected_token);
-            }
-            else if (chr == '>') {
-                printf("Closing arrow\n");
-                line++;
-                break;
+            double start = now();
+            bool ok = batch_parse_file(file, job->store, &table);
+            double elapsed = now() - start;
+
+            pthread_mutex_lock(&job->lock);
+            job->parse_seconds += elapsed;
+
+            // A malformed file is done (and failed) without being written
+            if (ok) {
+                batch_queue_push(&job->write_queue, file);
+                pthread_cond_broadcast(&job->changed);
             }
             else {
-                error_exit = true;
-                printf("Expected %s: Bad tag.\n", expected_token);
-                break;
+                batch_file_written(job, file, false);
             }
+            continue;
         }
 
-        // Advance the line pointer
-        line++;
+        // Every file has been read and handed out
+        if (job->next_read == job->files_length && job->reads_in_flight == 0)
+            break;
+
+        double start = now();
+        pthread_cond_wait(&job->changed, &job->lock);
+        job->parse_wait_seconds += now() - start;
     }
 
-    // Free all allocated pointers
-    if (attr_name) free(attr_name);
-    if (attr_value) free(attr_value);
-    if (tag_name) free(tag_name);
-    if (tag_content) free(tag_content);
+    intern_stats_add(&job->interned, &table);
+    pthread_mutex_unlock(&job->lock);
+    intern_table_free(&table);
 
-    if (error_exit) {
-        if (tag) {
-            free_tag(tag);
-        } 
-        exit(1);
-    }
+    return NULL;
+}
 
-    *line_ptr = line;
+/*
+ * I/O thread of the thread pool backend: writes finished outputs first, then reads ahead
+ * as long as fewer than BATCH_QUEUE_DEPTH files are held in memory
+ */
+void *batch_io_worker(void *arg) {
+    BatchJob *job = (BatchJob*) arg;
 
-    return tag;
+    pthread_mutex_lock(&job->lock);
+
+    while (job->finished < job->files_length) {
+        BatchFile *file = batch_queue_pop(&job->write_queue);
+
+        if (file) {
+            pthread_mutex_unlock(&job->lock);
+
+            double start = now();
+            bool ok = batch_write_file(file);
+            double elapsed = now() - start;
+
+            pthread_mutex_lock(&job->lock);
+            job->io_seconds += elapsed;
+            batch_file_written(job, file, ok);
+        }
+        else if (job->next_read < job->files_length && job->in_memory < BATCH_QUEUE_DEPTH) {
+            file = &job->files[job->next_read++];
+            job->in_memory++;
+            job->reads_in_flight++;
+            pthread_mutex_unlock(&job->lock);
+
+            double start = now();
+            bool ok = batch_read_file(file);
+            double elapsed = now() - start;
+
+            pthread_mutex_lock(&job->lock);
+            job->io_seconds += elapsed;
+            batch_file_read(job, file, ok);
+        }
+        else {
+            pthread_cond_wait(&job->changed, &job->lock);
+        }
+    }
+
+    pthread_mutex_unlock(&job->lock);
+    return NULL;
 }
 
-HTMLTag *parse_tags(FILE *stream) {
-    // Here's the idea:
-    // Find opening tag, set it as current_tag
-    // If another opening tag is found, set it as current_tag and parent is previous_tag
-    // If a closing tag is found and it matches current_tag, set current_tag as a child of its parent, and set current_tag to parent 
-    // If a closing tag is found and there's no parent, we reached the root tag
-    // If a closing tag is found and it doesn't match the current_tag, throw an error "Invalid syntax"
-    // Continue parsing
-    
-    char *line = NULL;
-    HTMLTag *current_tag = NULL;
+#ifdef HAVE_LIBURING
+/*
+ * I/O thread of the io_uring backend: keeps up to BATCH_QUEUE_DEPTH reads and all pending writes
+ * in flight on a single ring, so one thread drives all the I/O without blocking on each syscall
+ * Writes are tagged by setting the lowest bit of the BatchFile pointer in the completion's user data
+ */
+void *batch_uring_worker(void *arg) {
+    BatchJob *job = (BatchJob*) arg;
+    struct io_uring ring;
+    struct __kernel_timespec timeout = { .tv_sec = 0, .tv_nsec = 1000000 };
+    int in_flight = 0;
+
+    if (io_uring_queue_init(BATCH_QUEUE_DEPTH * 2, &ring, 0) < 0) {
+        printf("Failed to set up io_uring\n");
+        exit(1);
+    }
 
-    while((line = readline(stream)) != NULL) {
-        // We store the pointer to the whole line to be able to free it at the end
-        char *init_line_ptr = line;
+    pthread_mutex_lock(&job->lock);
 
-        while (*line) {
-            // TODO: Create a function that will free current_tag and all its children
-            HTMLTag *tag = next_tag(&line);
+    while (job->finished < job->files_length) {
+        BatchFile *file;
 
-            if (tag == NULL) {
-                break;
-            }
-            // Root opening tag
-            else if (!current_tag && is_opening_tag(tag)) {
-                printf("Found opening tag\n");
-                current_tag = tag;
-            }
-            // Closing tag without opening
-            else if (!current_tag && is_closing_tag(tag)) {
-                printf("Found tag: %s\n", tag->name);
-                perror("Closing tag must be preceeded with opening one");
-                exit(1);
-            }
-            // Nested opening tag
-            else if (current_tag && is_opening_tag(tag)) {
-                printf("Found opening tag\n");
-                tag->parent = current_tag;
-                current_tag = tag;
+        // Queue writes for everything the parsers finished
+        while (in_flight < BATCH_QUEUE_DEPTH * 2 && (file = batch_queue_pop(&job->write_queue)) != NULL) {
+            file->fd = open(file->output_filename, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+
+            if (file->fd < 0) {
+                perror(file->output_filename);
+                batch_file_written(job, file, false);
+                continue;
             }
-            // Non-closing tag
-            else if (current_tag && is_non_closing_tag(tag)) {
-                printf("Found non-closing tag\n");
-                add_child(current_tag, tag);
+
+            struct io_uring_sqe *sqe = io_uring_get_sqe(&ring);
+            io_uring_prep_write(sqe, file->fd, file->output, file->output_length, 0);
+            io_uring_sqe_set_data(sqe, (void*) ((uintptr_t) file | 1));
+            in_flight++;
+        }
+
+        // Queue reads ahead of the parsers
+        while (in_flight < BATCH_QUEUE_DEPTH * 2 && job->next_read < job->files_length && job->in_memory < BATCH_QUEUE_DEPTH) {
+            file = &job->files[job->next_read++];
+            job->in_memory++;
+            job->reads_in_flight++;
+
+            struct stat st;
+            file->fd = open(file->input_filename, O_RDONLY);
+
+            if (file->fd < 0 || fstat(file->fd, &st) < 0 || (file->data = malloc(st.st_size + 1)) == NULL) {
+                perror(file->input_filename);
+                if (file->fd >= 0) close(file->fd);
+                batch_file_read(job, file, false);
+                continue;
             }
-            // Closing tag
-            else if (current_tag && is_closing_tag(tag)) {
-                printf("Found closing tag\n");
-                printf("Current tag name: %s\n", current_tag->name);
 
-                if (open_close_tags_match(current_tag->name, tag->name)) {
-                    printf("Current opening tag and found closing tag match\n");
-                    if (current_tag->parent != NULL) {
-                        // Allocating memory for the tag pair's content  
-                        if (tag->content != NULL) {
-                            current_tag->content = strdup(tag->content); // +1 for null terminator
+            file->size = st.st_size;
 
-                            if (!current_tag->content) {
-                                printf("Failed to allocate memory for tag's content\n");
-                                exit(1);
-                            }
-                        }
+            struct io_uring_sqe *sqe = io_uring_get_sqe(&ring);
+            io_uring_prep_read(sqe, file->fd, file->data, file->size, 0);
+            io_uring_sqe_set_data(sqe, file);
+            in_flight++;
+        }
 
-                        // We aren't using the closing tag anywhere, so we free it
-                        free_tag(tag);
+        if (in_flight == 0) {
+            if (job->finished < job->files_length)
+                pthread_cond_wait(&job->changed, &job->lock);
+            continue;
+        }
 
-                        // Adding the tag pair to the parent tag 
-                        HTMLTag *parent = current_tag->parent;
-                        add_child(parent, current_tag);
-                        current_tag = parent;
-                    }
-                    else {
-                        free_tag(tag);
-                    }
-                }
-                else {
-                    printf("Opening and closing tags do not match.");
-                    exit(1);
+        pthread_mutex_unlock(&job->lock);
+
+        io_uring_submit(&ring);
+
+        // Wake up periodically so that freshly parsed outputs get their writes queued
+        struct io_uring_cqe *cqe;
+        double start = now();
+        int ret = io_uring_wait_cqe_timeout(&ring, &cqe, &timeout);
+        double elapsed = now() - start;
+
+        pthread_mutex_lock(&job->lock);
+        job->io_seconds += elapsed;
+
+        if (ret < 0)
+            continue;
+
+        // Reap every completion that's ready
+        do {
+            uintptr_t data = (uintptr_t) io_uring_cqe_get_data(cqe);
+            bool is_write = data & 1;
+            int res = cqe->res;
+
+            file = (BatchFile*) (data & ~(uintptr_t) 1);
+            io_uring_cqe_seen(&ring, cqe);
+            in_flight--;
+            close(file->fd);
+
+            if (is_write) {
+                bool ok = res >= 0 && (size_t) res == file->output_length;
+
+                // Rare short write: finish it synchronously
+                if (res >= 0 && !ok) {
+                    pthread_mutex_unlock(&job->lock);
+                    ok = batch_write_file(file);
+                    pthread_mutex_lock(&job->lock);
                 }
+
+                batch_file_written(job, file, ok);
             }
             else {
-                free_tag(tag);
-            }
-        }
+                bool ok = res >= 0 && (size_t) res == file->size;
 
-        free(init_line_ptr);
+                if (res >= 0 && !ok) {
+                    free(file->data);
+                    file->data = NULL;
+
+                    pthread_mutex_unlock(&job->lock);
+                    ok = batch_read_file(file);
+                    pthread_mutex_lock(&job->lock);
+                }
+                else if (!ok) {
+                    free(file->data);
+                    file->data = NULL;
+                }
+
+                batch_file_read(job, file, ok);
+            }
+        } while (io_uring_peek_cqe(&ring, &cqe) == 0);
     }
 
-    // Preview the HTML tags tree
-    printf("\n\n\nHTML Preview:\n");
-    print_all_tags(current_tag, 2);
-    printf("\n\n");
+    pthread_mutex_unlock(&job->lock);
+    io_uring_queue_exit(&ring);
 
-    return current_tag;
+    return NULL;
 }
+#endif
 
 /*
- * Creates an array of attribute objects and returns the pointer to the json object
+ * Converts a batch of files, each input.html to input.json
+ * I/O runs on its own threads (io_uring or a thread pool), so reading upcoming files and writing
+ * finished outputs overlap with parsing on the parser threads
  */
-json_object *json_create_attributes_array(Attribute **attrs, int attrs_length) {
-    json_object *json_attrs = json_object_new_array();
+int convert_batch(char **filenames, int files_length, char *backend, int workers_length, char *store_filename) {
+    BatchJob job = { 0 };
+    double start = now();
 
-    for (int i = 0; i < attrs_length; i++) {
-        Attribute *attr = *(attrs + i);
+    if (store_filename)
+        job.store = subtree_store_load(store_filename);
 
-        json_object *json_attr = json_object_new_object();
-        json_object_object_add(json_attr, "name", json_object_new_string(attr->name));
-        json_object_object_add(json_attr, "value", json_object_new_string(attr->value));
+    job.files = (BatchFile*) calloc(files_length, sizeof(BatchFile));
+    job.files_length = files_length;
 
-        json_object_array_add(json_attrs, json_attr);
+    if (job.files == NULL) {
+        perror("Failed to allocate memory for batch files");
+        exit(1);
     }
 
-    return json_attrs;
-}
+    for (int i = 0; i < files_length; i++) {
+        job.files[i].input_filename = filenames[i];
+        job.files[i].output_filename = batch_output_filename(filenames[i]);
+        job.files[i].fd = -1;
+    }
 
-/*
- * Creates a HTMLTag json object and returns the pointer to it
- */
-json_object *json_create_tag(HTMLTag *tag) {
-    json_object *json_tag = json_object_new_object();
-    json_object_object_add(json_tag, "name", json_object_new_string(tag->name));
+    pthread_mutex_init(&job.lock, NULL);
+    pthread_cond_init(&job.changed, NULL);
 
-    if (tag->content) 
-        json_object_object_add(json_tag, "content", json_object_new_string(tag->content));
+#ifdef HAVE_LIBURING
+    // Fall back to the thread pool if the kernel doesn't let us set up a ring
+    if (strequals(backend, "uring")) {
+        struct io_uring probe;
 
-    json_object_object_add(json_tag, "children_length", json_object_new_int(tag->children_length));
+        if (io_uring_queue_init(1, &probe, 0) < 0) {
+            printf("io_uring is unavailable, falling back to the thread pool\n");
+            backend = "threads";
+        }
+        else {
+            io_uring_queue_exit(&probe);
+        }
+    }
+#else
+    if (strequals(backend, "uring")) {
+        printf("io_uring support isn't compiled in (build with -DHAVE_LIBURING -luring), using the thread pool\n");
+        backend = "threads";
+    }
+#endif
 
-    if (tag->attribute_length > 0)
-        json_object_object_add(json_tag, "attributes", json_create_attributes_array(tag->attributes, tag->attribute_length));
+    int io_threads_length = strequals(backend, "uring") ? 1 : BATCH_IO_THREADS;
+    pthread_t *io_threads = (pthread_t*) calloc(io_threads_length, sizeof(pthread_t));
+    pthread_t *parse_threads = (pthread_t*) calloc(workers_length, sizeof(pthread_t));
 
-    json_object_object_add(json_tag, "attribute_length", json_object_new_int(tag->attribute_length));
+    if (io_threads == NULL || parse_threads == NULL) {
+        perror("Failed to allocate memory for batch threads");
+        exit(1);
+    }
 
-    return json_tag;
+    for (int i = 0; i < io_threads_length; i++) {
+#ifdef HAVE_LIBURING
+        void *(*io_worker)(void*) = strequals(backend, "uring") ? batch_uring_worker : batch_io_worker;
+#else
+        void *(*io_worker)(void*) = batch_io_worker;
+#endif
+        if (pthread_create(&io_threads[i], NULL, io_worker, &job) != 0) {
+            perror("Failed to start batch I/O thread");
+            exit(1);
+        }
+    }
+
+    for (int i = 0; i < workers_length; i++) {
+        if (pthread_create(&parse_threads[i], NULL, batch_parse_worker, &job) != 0) {
+            perror("Failed to start batch parser thread");
+            exit(1);
+        }
+    }
+
+    for (int i = 0; i < workers_length; i++) {
+        pthread_join(parse_threads[i], NULL);
+    }
+
+    for (int i = 0; i < io_threads_length; i++) {
+        pthread_join(io_threads[i], NULL);
+    }
+
+    double elapsed = now() - start;
+
+    printf("\nBatch summary (%s I/O, %d parser threads):\n", backend, workers_length);
+    printf("  Files:            %d converted, %d failed\n", files_length - job.failed, job.failed);
+    printf("  Wall time:        %.3f s\n", elapsed);
+    printf("  Throughput:       %.1f files/s, %.1f MB/s read, %.1f MB/s written\n",
+           files_length / elapsed, job.bytes_read / elapsed / 1e6, job.bytes_written / elapsed / 1e6);
+    printf("  Parsing:          %.3f s (summed over parser threads)\n", job.parse_seconds);
+    printf("  Parsers idle:     %.3f s waiting on input\n", job.parse_wait_seconds);
+    printf("  I/O:              %.3f s blocked on reads/writes\n", job.io_seconds);
+
+    print_intern_report(&job.interned, "  ");
+
+    if (job.store) {
+        printf("  Deduplication:    %d subtree references, %d shared subtrees, %d hash collisions\n",
+               job.store->references, job.store->stored, job.store->collisions);
+
+        if (!subtree_store_save(job.store, store_filename)) {
+            printf("Failed to save subtree store to %s\n", store_filename);
+            job.failed++;
+        }
+
+        subtree_store_free(job.store);
+    }
+
+    for (int i = 0; i < files_length; i++) {
+        free(job.files[i].output_filename);
+    }
+
+    free(job.files);
+    free(io_threads);
+    free(parse_threads);
+    pthread_mutex_destroy(&job.lock);
+    pthread_cond_destroy(&job.changed);
+
+    return job.failed > 0 ? 1 : 0;
 }
 
-/*
- * Recursively traverses root HTMLTag and its children creating json arrays containing respective nested HTMLTags
- */
-void json_traverse_children_and_create_tags(HTMLTag *root, json_object *json_root, json_object *root_children) {
-    bool add_children_array = root->children_length > 0;
+int main(int argc, char **argv) {
+    // Batch mode: html_to_json --batch [--io uring|threads] [--workers N] [--dedup store.json] <files...>
+    if (argc >= 3 && strequals(argv[1], "--batch")) {
+#ifdef HAVE_LIBURING
+        char *backend = "uring";
+#else
+        char *backend = "threads";
+#endif
+        int workers_length = BATCH_DEFAULT_WORKERS;
+        char *store_filename = NULL;
+        int i = 2;
+
+        while (i + 1 < argc && strncmp(argv[i], "--", 2) == 0) {
+            if (strequals(argv[i], "--io"))
+                backend = argv[i + 1];
+            else if (strequals(argv[i], "--workers"))
+                workers_length = atoi(argv[i + 1]);
+            else if (strequals(argv[i], "--dedup"))
+                store_filename = argv[i + 1];
+            else
+                break;
 
-    for (int i = 0; i < root->children_length; i++) {
-        HTMLTag *child = *(root->children + i);
-        json_object *json_child = json_create_tag(child);
-        json_object *child_children = json_object_new_array();
+            i += 2;
+        }
 
-        json_object_array_add(root_children, json_child);
-        if (child->children_length > 0) {
-            json_traverse_children_and_create_tags(child, json_child, child_children);
+        if (!strequals(backend, "uring") && !strequals(backend, "threads")) {
+            printf("Unknown I/O backend: %s\n", backend);
+            return 1;
         }
-        else {
-            json_object_put(child_children);
+
+        if (i == argc) {
+            printf("No input files given\n");
+            return 1;
         }
+
+        return convert_batch(argv + i, argc - i, backend, workers_length > 0 ? workers_length : BATCH_DEFAULT_WORKERS, store_filename);
     }
 
-    if (add_children_array)
-        json_object_object_add(json_root, "children", root_children);
-}
+    // Expand mode: html_to_json --expand <store.json> <deduplicated.json> [output.json]
+    if (argc >= 4 && strequals(argv[1], "--expand")) {
+        return expand_file(argv[2], argv[3], argc >= 5 ? argv[4] : "expanded.json");
+    }
+
+    // Text mode: html_to_json --text <input.html> [output.txt] [--boundaries]
+    if (argc >= 3 && strequals(argv[1], "--text")) {
+        char *text_filename = argc >= 4 && strncmp(argv[3], "--", 2) != 0 ? argv[3] : "index.txt";
+        bool boundaries = strequals(argv[argc - 1], "--boundaries");
+        return extract_text(argv[2], text_filename, boundaries);
+    }
+
+    // Diff mode: html_to_json --diff <old.html> <new.html> [edits.json]
+    if (argc >= 4 && strequals(argv[1], "--diff")) {
+        return diff_files(argv[2], argv[3], argc >= 5 ? argv[4] : "diff.json");
+    }
+
+    // Server mode: html_to_json --serve <socket> [workers]
+    if (argc >= 3 && strequals(argv[1], "--serve")) {
+        int workers_length = argc >= 4 ? atoi(argv[3]) : SERVER_DEFAULT_WORKERS;
+        return serve(argv[2], workers_length > 0 ? workers_length : SERVER_DEFAULT_WORKERS);
+    }
+
+    // WARC mode: html_to_json --warc <input.warc> [output.jsonl] [workers]
+    if (argc >= 3 && strequals(argv[1], "--warc")) {
+        char *output_filename = argc >= 4 ? argv[3] : "index.jsonl";
+        int workers_length = argc >= 5 ? atoi(argv[4]) : WARC_DEFAULT_WORKERS;
+        return convert_warc(argv[2], output_filename, workers_length > 0 ? workers_length : WARC_DEFAULT_WORKERS);
+    }
+
+    // Serialization benchmark: html_to_json --bench-serialize <input.html> [max_threads]
+    if (argc >= 3 && strequals(argv[1], "--bench-serialize")) {
+        int max_workers = argc >= 4 ? atoi(argv[3]) : (int) sysconf(_SC_NPROCESSORS_ONLN);
+        return benchmark_serialization(argv[2], max_workers > 0 ? max_workers : 1);
+    }
+
+    // html_to_json [--stop-after-bytes N] [--stop-after-nodes N] [--stop-at-close tag] [--stop-after-matches tag:N]
+    //              [input.html[.gz|.zst]] [output.json]
+    StopCondition stop = { 0 };
+    char *match_tag = NULL;
+    int i = 1;
+
+    while (i + 1 < argc && strncmp(argv[i], "--stop-", 7) == 0) {
+        if (strequals(argv[i], "--stop-after-bytes"))
+            stop.max_bytes = strtoull(argv[i + 1], NULL, 10);
+        else if (strequals(argv[i], "--stop-after-nodes"))
+            stop.max_nodes = atoi(argv[i + 1]);
+        else if (strequals(argv[i], "--stop-at-close"))
+            stop.close_tag = argv[i + 1];
+        else if (strequals(argv[i], "--stop-after-matches")) {
+            // E.g. a:10 stops after the first 10 links, a name alone stops after the first match
+            const char *colon = strchr(argv[i + 1], ':');
+            free(match_tag);
+            match_tag = colon ? strndup(argv[i + 1], colon - argv[i + 1]) : strdup(argv[i + 1]);
+            stop.match_tag = match_tag;
+            stop.match_count = colon ? atoi(colon + 1) : 1;
+        }
+        else {
+            printf("Unknown option: %s\n", argv[i]);
+            return 1;
+        }
+
+        i += 2;
+    }
 
-int main(void) {
-    FILE *stream = open_file();
-    char *json_filename = "index.json";
+    char *html_filename = argc >= i + 1 ? argv[i] : "index.html";
+    char *json_filename = argc >= i + 2 ? argv[i + 1] : "index.json";
+    Decompressor *decompressor;
+    FILE *stream = open_file(html_filename, &decompressor);
 
     if (!stream) return 1;
 
-    // Root HTML tag
-    HTMLTag *root_tag = parse_tags(stream);
+    InternTable table;
+    intern_table_init(&table);
 
-    // Array of tags
-    json_object *tags = json_object_new_array();
+    // Root HTML tag
+    const char *error;
+    HTMLTag *root_tag = parse_tags_until(stream, i > 1 ? &stop : NULL, &table, &error);
+    bool read_ok = close_file(stream, decompressor);
+
+    if (error) {
+        printf("Failed to parse %s: %s\n", html_filename, error);
+        free(match_tag);
+        intern_table_free(&table);
+        return 1;
+    }
 
-    json_object *json_root_tag = json_create_tag(root_tag);
-    json_object *json_root_tag_children = json_object_new_array();
+    // Don't save a tree built from a truncated input
+    if (!read_ok) {
+        printf("Failed to read %s\n", html_filename);
+        if (root_tag)
+            free_tag(root_tag);
+        free(match_tag);
+        intern_table_free(&table);
+        return 1;
+    }
 
-    json_traverse_children_and_create_tags(root_tag, json_root_tag, json_root_tag_children);
+    if (stop.stopped)
+        printf("Stopped after %zu bytes and %d tags\n", stop.bytes_parsed, stop.nodes_length);
 
-    json_object_array_add(tags, json_root_tag);
+    // Large documents are serialized on all cores
+    int serialize_workers = (int) sysconf(_SC_NPROCESSORS_ONLN);
+    json_object *tags = json_create_document_parallel(root_tag, serialize_workers, JSON_OUTPUT_FLAGS);
 
     // Save JSON to file
-    if (json_object_to_file_ext(json_filename, tags, JSON_C_TO_STRING_PRETTY)) {
+    if (json_object_to_file_ext(json_filename, tags, JSON_OUTPUT_FLAGS)) {
         printf("Failed to save JSON to %s\n", json_filename);
     }
     else {
         printf("Saved JSON representation to %s\n", json_filename);
     }
 
+    InternStats interned = { 0 };
+    intern_stats_add(&interned, &table);
+    print_intern_report(&interned, "");
+
     // Free and cleanup everything
     json_object_put(tags);
-    free_tag(root_tag);
-    fclose(stream);
+    if (root_tag)
+        free_tag(root_tag);
+    free(match_tag);
+    intern_table_free(&table);
 
     return 0;
 }
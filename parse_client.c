@@ -0,0 +1,352 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+#include <time.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+/*
+ * Load generator for `html_to_json --serve`
+ *
+ * Usage: parse_client <socket> <file.html> [connections] [requests_per_connection] [pipeline_depth]
+ *
+ * Every connection sends the same HTML file as length-prefixed requests, keeping up to
+ * pipeline_depth requests in flight, and measures the latency of each response.
+ */
+
+typedef struct Connection {
+    int fd;
+    const char *payload;
+    uint32_t payload_length;
+    int requests_length;
+    int pipeline_depth;
+
+    // Send timestamps of in-flight requests, a ring of pipeline_depth entries
+    double *sent_at;
+    int in_flight;
+    pthread_mutex_t lock;
+    pthread_cond_t slot_free;
+
+    double *latencies; // one per completed request, in seconds
+    int completed_length; // requests answered before the connection failed (if it did)
+    int errors_length; // answered with an error frame, e.g. malformed HTML
+    bool failed;
+} Connection;
+
+#define DEFAULT_CONNECTIONS 4
+#define DEFAULT_REQUESTS 1000
+#define DEFAULT_PIPELINE_DEPTH 8
+
+double now();
+char *read_file(const char *fname, size_t *length);
+bool read_exact(int fd, void *buf, size_t length);
+bool write_exact(int fd, const void *buf, size_t length);
+int connect_socket(const char *socket_path);
+void *send_requests(void *arg);
+void *run_connection(void *arg);
+int compare_doubles(const void *a, const void *b);
+double percentile(double *sorted, int length, double p);
+
+/*
+ * Returns monotonic time in seconds
+ */
+double now() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/*
+ * Reads a whole file into a newly allocated buffer
+ */
+char *read_file(const char *fname, size_t *length) {
+    FILE *fp = fopen(fname, "rb");
+    if (!fp) {
+        perror("File opening failed");
+        return NULL;
+    }
+
+    fseek(fp, 0, SEEK_END);
+    *length = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+
+    char *buf = (char*) malloc(*length + 1);
+    if (buf == NULL || fread(buf, 1, *length, fp) != *length) {
+        perror("Failed to read file");
+        free(buf);
+        fclose(fp);
+        return NULL;
+    }
+
+    fclose(fp);
+    return buf;
+}
+
+/*
+ * Reads exactly length bytes from a file descriptor
+ * Returns false on EOF or error
+ */
+bool read_exact(int fd, void *buf, size_t length) {
+    char *b = (char*) buf;
+
+    while (length > 0) {
+        ssize_t n = read(fd, b, length);
+        if (n <= 0)
+            return false;
+
+        b += n;
+        length -= n;
+    }
+
+    return true;
+}
+
+/*
+ * Writes exactly length bytes to a socket
+ * Returns false on error, including a connection closed by the server (EPIPE instead of a SIGPIPE killing the client)
+ */
+bool write_exact(int fd, const void *buf, size_t length) {
+    const char *b = (const char*) buf;
+
+    while (length > 0) {
+        ssize_t n = send(fd, b, length, MSG_NOSIGNAL);
+        if (n < 0)
+            return false;
+
+        b += n;
+        length -= n;
+    }
+
+    return true;
+}
+
+/*
+ * Connects to a Unix domain socket and returns the file descriptor, or -1 on failure
+ */
+int connect_socket(const char *socket_path) {
+    struct sockaddr_un addr = { .sun_family = AF_UNIX };
+
+    if (strlen(socket_path) >= sizeof(addr.sun_path)) {
+        printf("Socket path is too long: %s\n", socket_path);
+        return -1;
+    }
+
+    strcpy(addr.sun_path, socket_path);
+
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0) {
+        perror("Failed to create socket");
+        return -1;
+    }
+
+    if (connect(fd, (struct sockaddr*) &addr, sizeof(addr)) < 0) {
+        perror("Failed to connect");
+        close(fd);
+        return -1;
+    }
+
+    return fd;
+}
+
+/*
+ * Sender thread: writes requests as long as fewer than pipeline_depth are in flight
+ */
+void *send_requests(void *arg) {
+    Connection *conn = (Connection*) arg;
+    uint32_t header = htonl(conn->payload_length);
+
+    for (int i = 0; i < conn->requests_length; i++) {
+        pthread_mutex_lock(&conn->lock);
+        while (conn->in_flight == conn->pipeline_depth && !conn->failed)
+            pthread_cond_wait(&conn->slot_free, &conn->lock);
+
+        if (conn->failed) {
+            pthread_mutex_unlock(&conn->lock);
+            break;
+        }
+
+        conn->sent_at[i % conn->pipeline_depth] = now();
+        conn->in_flight++;
+        pthread_mutex_unlock(&conn->lock);
+
+        if (!write_exact(conn->fd, &header, sizeof(header)) ||
+            !write_exact(conn->fd, conn->payload, conn->payload_length)) {
+            perror("Failed to send request");
+            break;
+        }
+    }
+
+    return NULL;
+}
+
+/*
+ * Connection thread: starts the sender and reads responses in order, recording latencies
+ */
+void *run_connection(void *arg) {
+    Connection *conn = (Connection*) arg;
+    pthread_t sender;
+    char *response = NULL;
+    size_t response_size = 0;
+
+    pthread_create(&sender, NULL, send_requests, conn);
+
+    for (int i = 0; i < conn->requests_length; i++) {
+        uint32_t header;
+
+        if (!read_exact(conn->fd, &header, sizeof(header))) {
+            conn->failed = true;
+            break;
+        }
+
+        size_t length = ntohl(header);
+        if (length > response_size) {
+            free(response);
+            response = (char*) malloc(length);
+            response_size = length;
+        }
+
+        if (response == NULL || !read_exact(conn->fd, response, length)) {
+            conn->failed = true;
+            break;
+        }
+
+        // Error frames are objects ({"error": ...}), parsed documents are arrays
+        if (length > 0 && response[0] == '{')
+            conn->errors_length++;
+
+        pthread_mutex_lock(&conn->lock);
+        conn->latencies[i] = now() - conn->sent_at[i % conn->pipeline_depth];
+        conn->completed_length++;
+        conn->in_flight--;
+        pthread_cond_signal(&conn->slot_free);
+        pthread_mutex_unlock(&conn->lock);
+    }
+
+    if (conn->failed) {
+        printf("Connection closed by server\n");
+
+        // Wake the sender up so that it can exit
+        pthread_mutex_lock(&conn->lock);
+        pthread_cond_signal(&conn->slot_free);
+        pthread_mutex_unlock(&conn->lock);
+        shutdown(conn->fd, SHUT_RDWR);
+    }
+
+    pthread_join(sender, NULL);
+    free(response);
+
+    return NULL;
+}
+
+int compare_doubles(const void *a, const void *b) {
+    double x = *(const double*) a;
+    double y = *(const double*) b;
+    return (x > y) - (x < y);
+}
+
+/*
+ * Returns the p-th percentile (0..100) of a sorted array
+ */
+double percentile(double *sorted, int length, double p) {
+    int index = (int) (p / 100.0 * (length - 1) + 0.5);
+    return sorted[index];
+}
+
+int main(int argc, char **argv) {
+    if (argc < 3) {
+        printf("Usage: %s <socket> <file.html> [connections] [requests_per_connection] [pipeline_depth]\n", argv[0]);
+        return 1;
+    }
+
+    int connections_length = argc >= 4 ? atoi(argv[3]) : DEFAULT_CONNECTIONS;
+    int requests_length = argc >= 5 ? atoi(argv[4]) : DEFAULT_REQUESTS;
+    int pipeline_depth = argc >= 6 ? atoi(argv[5]) : DEFAULT_PIPELINE_DEPTH;
+
+    if (connections_length <= 0 || requests_length <= 0 || pipeline_depth <= 0) {
+        printf("Connections, requests and pipeline depth must be positive\n");
+        return 1;
+    }
+
+    size_t payload_length;
+    char *payload = read_file(argv[2], &payload_length);
+    if (!payload) return 1;
+
+    Connection *conns = (Connection*) calloc(connections_length, sizeof(Connection));
+    pthread_t *threads = (pthread_t*) calloc(connections_length, sizeof(pthread_t));
+
+    for (int i = 0; i < connections_length; i++) {
+        conns[i].fd = connect_socket(argv[1]);
+        if (conns[i].fd < 0) return 1;
+
+        conns[i].payload = payload;
+        conns[i].payload_length = payload_length;
+        conns[i].requests_length = requests_length;
+        conns[i].pipeline_depth = pipeline_depth;
+        conns[i].sent_at = (double*) calloc(pipeline_depth, sizeof(double));
+        conns[i].latencies = (double*) calloc(requests_length, sizeof(double));
+        pthread_mutex_init(&conns[i].lock, NULL);
+        pthread_cond_init(&conns[i].slot_free, NULL);
+    }
+
+    double start = now();
+
+    for (int i = 0; i < connections_length; i++) {
+        pthread_create(&threads[i], NULL, run_connection, &conns[i]);
+    }
+
+    for (int i = 0; i < connections_length; i++) {
+        pthread_join(threads[i], NULL);
+    }
+
+    double elapsed = now() - start;
+
+    // Merge latencies of all connections, only requests that got a response count
+    int total = connections_length * requests_length;
+    double *latencies = (double*) calloc(total, sizeof(double));
+    int completed = 0;
+    int errors = 0;
+    int failed_connections = 0;
+
+    for (int i = 0; i < connections_length; i++) {
+        memcpy(latencies + completed, conns[i].latencies, conns[i].completed_length * sizeof(double));
+        completed += conns[i].completed_length;
+        errors += conns[i].errors_length;
+        failed_connections += conns[i].failed;
+    }
+
+    qsort(latencies, completed, sizeof(double), compare_doubles);
+
+    printf("Requests:     %d of %d completed (%d connections, pipeline depth %d)\n", completed, total, connections_length, pipeline_depth);
+    printf("Failed:       %d requests unanswered, %d connections closed by server\n", total - completed, failed_connections);
+    printf("Errors:       %d responses were error frames\n", errors);
+    printf("Elapsed:      %.3f s\n", elapsed);
+    printf("Throughput:   %.0f requests/s, %.1f MB/s\n", completed / elapsed, completed * (double) payload_length / elapsed / 1e6);
+
+    if (completed > 0) {
+        printf("Latency p50:  %.3f ms\n", percentile(latencies, completed, 50) * 1e3);
+        printf("Latency p99:  %.3f ms\n", percentile(latencies, completed, 99) * 1e3);
+        printf("Latency p99.9: %.3f ms\n", percentile(latencies, completed, 99.9) * 1e3);
+        printf("Latency max:  %.3f ms\n", latencies[completed - 1] * 1e3);
+    }
+
+    for (int i = 0; i < connections_length; i++) {
+        close(conns[i].fd);
+        free(conns[i].sent_at);
+        free(conns[i].latencies);
+        pthread_mutex_destroy(&conns[i].lock);
+        pthread_cond_destroy(&conns[i].slot_free);
+    }
+
+    free(latencies);
+    free(conns);
+    free(threads);
+    free(payload);
+
+    return failed_connections > 0 ? 1 : 0;
+}